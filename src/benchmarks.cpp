@@ -0,0 +1,77 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <list>
+#include <map>
+#include <numeric>
+#include <random>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+namespace bench {
+// Не даёт компилятору выбросить результат измеряемого цикла
+volatile size_t sink = 0;
+
+// Время выполнения f в секундах
+template <class F>
+double seconds(F &&f) {
+  auto start = std::chrono::steady_clock::now();
+  f();
+  std::chrono::duration<double> diff = std::chrono::steady_clock::now() - start;
+  return diff.count();
+}
+
+void report(const char *name, size_t n, double sec) {
+  std::printf("%-44s n=%-10zu %10.3f ms %10.2f Mops/s\n", name, n, sec * 1e3,
+              sec > 0 ? n / sec / 1e6 : 0.0);
+}
+
+// Перемешанные ключи 0..n-1, одинаковые от запуска к запуску
+std::vector<int> shuffled_keys(size_t n) {
+  std::vector<int> keys(n);
+  for (size_t i = 0; i < n; i++) keys[i] = static_cast<int>(i);
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+  return keys;
+}
+}  // namespace bench
+
+#include "bench_bitset.inc"
+#include "bench_chunked_list.inc"
+#include "bench_concurrent_map.inc"
+#include "bench_list.inc"
+#include "bench_map.inc"
+#include "bench_mmap_vector.inc"
+#include "bench_parallel.inc"
+#include "bench_radix_map.inc"
+#include "bench_simd.inc"
+#include "bench_slot_map.inc"
+#include "bench_soa_vector.inc"
+#include "bench_sort.inc"
+#include "bench_span.inc"
+#include "bench_vector.inc"
+
+int main() {
+  bench_list();
+  bench_chunked_list();
+  bench_map();
+  bench_radix_map();
+  bench_concurrent_map();
+  bench_vector();
+  bench_mmap_vector();
+  bench_simd();
+  bench_bitset();
+  bench_soa_vector();
+  bench_slot_map();
+  bench_parallel();
+  bench_sort();
+  bench_span();
+  return 0;
+}
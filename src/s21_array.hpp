@@ -1,10 +1,37 @@
 #ifndef SRC_S21_ARRAY_HPP_
 #define SRC_S21_ARRAY_HPP_
 
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_simd.hpp"
+
 namespace s21 {
+
+namespace array_detail {
+// Хранилище array: ровно N элементов, при N == 0 - пустая структура
+template <class T, size_t N>
+struct storage {
+  using type = T[N];
+  static constexpr T *ptr(type &items) { return items; }
+  static constexpr const T *ptr(const type &items) { return items; }
+};
+
+template <class T>
+struct storage<T, 0> {
+  struct type {};
+  static constexpr T *ptr(type &) { return nullptr; }
+  static constexpr const T *ptr(const type &) { return nullptr; }
+};
+}  // namespace array_detail
+
+// Агрегат, как std::array: инициализируется списком {1, 2, 3}, занимает
+// ровно N элементов и тривиально копируется, если тривиально копируется T.
+// Без инициализатора элементы не инициализируются, array<T, N> a{} их
+// обнуляет
 template <class T, size_t size_>
-class array {
- public:
+struct array {
   using value_type = T;
   using reference = T &;
   using const_reference = const T &;
@@ -12,89 +39,91 @@ class array {
   using const_iterator = const T *;
   using size_type = size_t;
 
-  array() = default;  // Конструктор по умолчанию
-  ~array() = default;
-
-  explicit array(std::initializer_list<value_type> const &items) {
-    int i = 0;
-    for (auto &elem : items) {
-      array_[i] = elem;
-      i++;
-    }
-  }  // Коструктор с помощью списка иницилизации
-
-  array(const array &a) {
-    for (size_t i = 0; i < size_; i++) {
-      array_[i] = a.array_[i];
-    }
-  }  // Конструктор копирования
-
-  array(array &&a) = default;  // Конструктор перемещения
-
-  array &operator=(array &&a) =
-      default;  // Перегрузка оператора присваивания для движущигося оьекта
-
-  reference at(size_type pos) {
+  constexpr reference at(size_type pos) {
     if (pos >= size_) {
       throw std::out_of_range("Out of bounds array");
     }
-    return array_[pos];
+    return data()[pos];
   }  // Доступ к указаному элементу с проверкой границ
+  constexpr const_reference at(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("Out of bounds array");
+    }
+    return data()[pos];
+  }
 
-  reference operator[](size_type pos) {
-    return array_[pos];
+  constexpr reference operator[](size_type pos) {
+    return data()[pos];
   }  // Доступ к указаному элементу
+  constexpr const_reference operator[](size_type pos) const {
+    return data()[pos];
+  }
 
-  const_reference front() {
-    return array_[0];
-  }  // Получить доступ к первому элемнту
+  constexpr reference front() {
+    return data()[0];
+  }  // Получить доступ к первому элементу
+  constexpr const_reference front() const { return data()[0]; }
 
-  const_reference back() {
-    return array_[size_ - 1];
-  }  // Получить доступ к последнему элемнту
+  constexpr reference back() {
+    return data()[size_ - 1];
+  }  // Получить доступ к последнему элементу
+  constexpr const_reference back() const { return data()[size_ - 1]; }
 
-  iterator data() { return array_; }  // Прямой доступ к базовому массиву
+  constexpr iterator data() {
+    return storage::ptr(array_);
+  }  // Прямой доступ к базовому массиву
+  constexpr const_iterator data() const { return storage::ptr(array_); }
 
   ///
 
-  iterator begin() { return array_; }  // Возвращает итератор в начало
+  constexpr iterator begin() { return data(); }  // Итератор на начало
+  constexpr const_iterator begin() const { return data(); }
+  constexpr const_iterator cbegin() const { return data(); }
 
-  iterator end() {
-    return (array_ + size_ - 1);
-  }  // Возвращает итератор в конец
+  constexpr iterator end() {
+    return data() + size_;
+  }  // Итератор за последним элементом
+  constexpr const_iterator end() const { return data() + size_; }
+  constexpr const_iterator cend() const { return data() + size_; }
 
   ///
 
-  bool empty() { return (size_ == 0); }  // Проверяет массив на пустоту +?
+  static constexpr bool empty() {
+    return size_ == 0;
+  }  // Проверяет массив на пустоту
 
-  size_type size() { return size_; }  // Возвращает количество элементов
+  static constexpr size_type size() {
+    return size_;
+  }  // Возвращает количество элементов
 
-  size_type max_size() {
+  static constexpr size_type max_size() {
     return size_;
   }  // Возвращает максимальное количество элементов
 
   ///
 
-  void swap(array &other) {
-    if (size_ != other.size()) {
-      throw std::out_of_range("Different array sizes");
-    }
-    value_type tmp;
-    for (size_t i = 0; i < size_; i++) {
-      tmp = array_[i];
-      array_[i] = other.array_[i];
-      other.array_[i] = tmp;
+  constexpr void swap(array &other) {
+    for (size_type i = 0; i < size_; i++) {
+      value_type tmp = std::move(data()[i]);
+      data()[i] = std::move(other.data()[i]);
+      other.data()[i] = std::move(tmp);
     }
   }  // Меняет массивы местами
 
-  void fill(const_reference value) {
-    for (size_t i = 0; i < size(); i++) {
-      array_[i] = value;
+  // При вычислении во время компиляции - простой цикл, иначе simd::fill
+  constexpr void fill(const_reference value) {
+#if defined(__GNUC__)
+    if (!__builtin_is_constant_evaluated()) {
+      simd::fill(data(), data() + size_, value);
+      return;
     }
+#endif
+    for (size_type i = 0; i < size_; i++) data()[i] = value;
   }  // Заполняет весь массив заданным значением
 
- private:
-  alignas(T) T array_[sizeof(T) * size_] = {};
+  using storage = array_detail::storage<T, size_>;
+  // Открыт только ради агрегатной инициализации, напрямую не используется
+  typename storage::type array_;
 };
 }  // namespace s21
 
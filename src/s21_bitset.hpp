@@ -0,0 +1,503 @@
+#ifndef SRC_S21_BITSET_HPP_
+#define SRC_S21_BITSET_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "s21_array.hpp"
+#include "s21_simd.hpp"
+#include "s21_vector.hpp"
+
+namespace s21 {
+
+namespace bits {
+
+constexpr size_t kWordBits = 64;
+
+constexpr size_t words_for(size_t bits) {
+  return (bits + kWordBits - 1) / kWordBits;
+}
+
+// Маска значащих битов последнего слова множества из bits битов
+constexpr uint64_t tail_mask(size_t bits) {
+  return bits % kWordBits ? (uint64_t(1) << (bits % kWordBits)) - 1
+                          : ~uint64_t(0);
+}
+
+// Первый единичный бит с номером не меньше pos или bits, если таких нет
+inline size_t find_from(const uint64_t *words, size_t bits, size_t pos) {
+  if (pos >= bits) return bits;
+  size_t w = pos / kWordBits;
+  uint64_t word = words[w] & (~uint64_t(0) << (pos % kWordBits));
+  size_t count = words_for(bits);
+  while (!word) {
+    if (++w == count) return bits;
+    word = words[w];
+  }
+  return w * kWordBits + static_cast<size_t>(__builtin_ctzll(word));
+}
+
+}  // namespace bits
+
+// Ссылка на бит: слово и маска бита в нём
+class bit_reference {
+ public:
+  bit_reference(uint64_t *word, uint64_t mask) : word_(word), mask_(mask) {}
+  bit_reference(const bit_reference &) = default;
+
+  operator bool() const { return (*word_ & mask_) != 0; }
+  bool operator~() const { return !bool(*this); }
+  bit_reference &operator=(bool value) {
+    if (value) {
+      *word_ |= mask_;
+    } else {
+      *word_ &= ~mask_;
+    }
+    return *this;
+  }
+  bit_reference &operator=(const bit_reference &other) {
+    return *this = bool(other);
+  }
+  bit_reference &flip() {
+    *word_ ^= mask_;
+    return *this;
+  }
+  // Прокси - временный объект, std::swap(T &, T &) к нему не подходит.
+  // Эти перегрузки находит ADL в std::iter_swap, std::reverse, std::sort
+  friend void swap(bit_reference a, bit_reference b) noexcept {
+    bool tmp = a;
+    a = bool(b);
+    b = tmp;
+  }
+  friend void swap(bit_reference a, bool &b) noexcept {
+    bool tmp = a;
+    a = b;
+    b = tmp;
+  }
+  friend void swap(bool &a, bit_reference b) noexcept { swap(b, a); }
+
+ private:
+  uint64_t *word_;
+  uint64_t mask_;
+};
+
+// Итератор произвольного доступа по битам; разыменование даёт
+// bit_reference, у константного - bool
+template <bool Const>
+class bit_iterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = bool;
+  using difference_type = std::ptrdiff_t;
+  using reference = std::conditional_t<Const, bool, bit_reference>;
+  using pointer = void;
+  using word_pointer = std::conditional_t<Const, const uint64_t *, uint64_t *>;
+
+  bit_iterator() = default;
+  bit_iterator(word_pointer words, size_t pos) : words_(words), pos_(pos) {}
+  template <bool Other, std::enable_if_t<Const && !Other, int> = 0>
+  bit_iterator(const bit_iterator<Other> &it)
+      : words_(it.words_), pos_(it.pos_) {}
+
+  reference operator*() const { return at(pos_); }
+  reference operator[](difference_type n) const { return at(pos_ + n); }
+  bit_iterator &operator++() {
+    ++pos_;
+    return *this;
+  }
+  bit_iterator &operator--() {
+    --pos_;
+    return *this;
+  }
+  bit_iterator operator++(int) { return {words_, pos_++}; }
+  bit_iterator operator--(int) { return {words_, pos_--}; }
+  bit_iterator &operator+=(difference_type n) {
+    pos_ += n;
+    return *this;
+  }
+  bit_iterator &operator-=(difference_type n) {
+    pos_ -= n;
+    return *this;
+  }
+  bit_iterator operator+(difference_type n) const {
+    return {words_, pos_ + n};
+  }
+  bit_iterator operator-(difference_type n) const {
+    return {words_, pos_ - n};
+  }
+  difference_type operator-(const bit_iterator &it) const {
+    return static_cast<difference_type>(pos_) -
+           static_cast<difference_type>(it.pos_);
+  }
+  bool operator==(const bit_iterator &it) const { return pos_ == it.pos_; }
+  bool operator!=(const bit_iterator &it) const { return pos_ != it.pos_; }
+  bool operator<(const bit_iterator &it) const { return pos_ < it.pos_; }
+  bool operator>(const bit_iterator &it) const { return pos_ > it.pos_; }
+  bool operator<=(const bit_iterator &it) const { return pos_ <= it.pos_; }
+  bool operator>=(const bit_iterator &it) const { return pos_ >= it.pos_; }
+
+ private:
+  friend class bit_iterator<!Const>;
+
+  word_pointer words_{nullptr};
+  size_t pos_{0};
+
+  reference at(size_t pos) const {
+    uint64_t mask = uint64_t(1) << (pos % bits::kWordBits);
+    if constexpr (Const) {
+      return (words_[pos / bits::kWordBits] & mask) != 0;
+    } else {
+      return bit_reference(words_ + pos / bits::kWordBits, mask);
+    }
+  }
+};
+
+// Битовое множество переменной длины: по биту на флаг в 64-битных
+// словах s21::vector. Биты за концом последнего слова всегда нулевые,
+// поэтому count(), сравнение и поиск работают по словам целиком.
+// Побитовые операции и подсчёт идут через ядра s21::simd. Используется
+// вместо упакованной специализации vector<bool>: у неё не было бы data()
+// и ссылок на элементы, которые обещает интерфейс vector
+class dynamic_bitset {
+ public:
+  using value_type = bool;
+  using reference = bit_reference;
+  using const_reference = bool;
+  using size_type = size_t;
+  using iterator = bit_iterator<false>;
+  using const_iterator = bit_iterator<true>;
+
+  dynamic_bitset() = default;
+  explicit dynamic_bitset(size_type n, bool value = false) {
+    resize(n, value);
+  }
+
+  reference operator[](size_type pos) {
+    return reference(&words_[pos / bits::kWordBits], bit(pos));
+  }
+  bool operator[](size_type pos) const {
+    return (words_[pos / bits::kWordBits] & bit(pos)) != 0;
+  }
+  // Значение бита с проверкой границ
+  bool test(size_type pos) const;
+  uint64_t *data() { return words_.data(); }
+  const uint64_t *data() const { return words_.data(); }
+  size_type word_count() const { return words_.size(); }
+
+  iterator begin() { return iterator(words_.data(), 0); }
+  iterator end() { return iterator(words_.data(), size_); }
+  const_iterator begin() const { return const_iterator(words_.data(), 0); }
+  const_iterator end() const { return const_iterator(words_.data(), size_); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type capacity() const { return words_.capacity() * bits::kWordBits; }
+  void reserve(size_type n) { words_.reserve(bits::words_for(n)); }
+
+  void clear();
+  void push_back(bool value);
+  void pop_back();
+  void resize(size_type n, bool value = false);
+  void swap(dynamic_bitset &other);
+
+  dynamic_bitset &set();
+  dynamic_bitset &set(size_type pos, bool value = true);
+  dynamic_bitset &reset();
+  dynamic_bitset &reset(size_type pos) { return set(pos, false); }
+  dynamic_bitset &flip();
+  dynamic_bitset &flip(size_type pos);
+
+  // Число единичных битов
+  size_type count() const { return simd::popcount(data(), word_count()); }
+  bool any() const;
+  bool none() const { return !any(); }
+  bool all() const { return count() == size_; }
+  // Первый единичный бит или size(), если их нет
+  size_type find_first() const { return bits::find_from(data(), size_, 0); }
+  // Следующий за pos единичный бит или size()
+  size_type find_next(size_type pos) const {
+    return bits::find_from(data(), size_, pos + 1);
+  }
+
+  // Операции требуют одинаковой длины
+  dynamic_bitset &operator&=(const dynamic_bitset &other);
+  dynamic_bitset &operator|=(const dynamic_bitset &other);
+  dynamic_bitset &operator^=(const dynamic_bitset &other);
+  // this &= ~other
+  dynamic_bitset &subtract(const dynamic_bitset &other);
+  dynamic_bitset operator~() const { return dynamic_bitset(*this).flip(); }
+  bool operator==(const dynamic_bitset &other) const;
+  bool operator!=(const dynamic_bitset &other) const {
+    return !(*this == other);
+  }
+  // Биты от старшего к младшему, как у std::bitset::to_string
+  std::string to_string() const;
+
+ private:
+  vector<uint64_t> words_;
+  size_type size_{0};
+
+  static uint64_t bit(size_type pos) {
+    return uint64_t(1) << (pos % bits::kWordBits);
+  }
+  // Обнуляет биты за концом множества
+  void trim();
+  void check_size(const dynamic_bitset &other) const;
+};
+
+inline bool dynamic_bitset::test(size_type pos) const {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return (*this)[pos];
+}
+
+inline void dynamic_bitset::clear() {
+  words_.clear();
+  size_ = 0;
+}
+
+inline void dynamic_bitset::push_back(bool value) {
+  if (size_ % bits::kWordBits == 0) words_.push_back(0);
+  size_++;
+  if (value) words_[(size_ - 1) / bits::kWordBits] |= bit(size_ - 1);
+}
+
+inline void dynamic_bitset::pop_back() {
+  if (!size_) return;
+  size_--;
+  if (size_ % bits::kWordBits == 0) {
+    words_.pop_back();
+  } else {
+    trim();
+  }
+}
+
+inline void dynamic_bitset::resize(size_type n, bool value) {
+  size_type old_size = size_;
+  if (value && old_size % bits::kWordBits && n > old_size) {
+    words_[old_size / bits::kWordBits] |= ~bits::tail_mask(old_size);
+  }
+  words_.resize(bits::words_for(n), value ? ~uint64_t(0) : 0);
+  size_ = n;
+  trim();
+}
+
+inline void dynamic_bitset::swap(dynamic_bitset &other) {
+  words_.swap(other.words_);
+  std::swap(size_, other.size_);
+}
+
+inline dynamic_bitset &dynamic_bitset::set() {
+  simd::fill(words_, ~uint64_t(0));
+  trim();
+  return *this;
+}
+
+inline dynamic_bitset &dynamic_bitset::set(size_type pos, bool value) {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  (*this)[pos] = value;
+  return *this;
+}
+
+inline dynamic_bitset &dynamic_bitset::reset() {
+  simd::fill(words_, uint64_t(0));
+  return *this;
+}
+
+inline dynamic_bitset &dynamic_bitset::flip() {
+  simd::bit_not(data(), word_count());
+  trim();
+  return *this;
+}
+
+inline dynamic_bitset &dynamic_bitset::flip(size_type pos) {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  (*this)[pos].flip();
+  return *this;
+}
+
+inline bool dynamic_bitset::any() const {
+  return bits::find_from(data(), size_, 0) != size_;
+}
+
+inline dynamic_bitset &dynamic_bitset::operator&=(
+    const dynamic_bitset &other) {
+  check_size(other);
+  simd::bit_and(data(), other.data(), word_count());
+  return *this;
+}
+
+inline dynamic_bitset &dynamic_bitset::operator|=(
+    const dynamic_bitset &other) {
+  check_size(other);
+  simd::bit_or(data(), other.data(), word_count());
+  return *this;
+}
+
+inline dynamic_bitset &dynamic_bitset::operator^=(
+    const dynamic_bitset &other) {
+  check_size(other);
+  simd::bit_xor(data(), other.data(), word_count());
+  return *this;
+}
+
+inline dynamic_bitset &dynamic_bitset::subtract(const dynamic_bitset &other) {
+  check_size(other);
+  simd::bit_and_not(data(), other.data(), word_count());
+  return *this;
+}
+
+inline bool dynamic_bitset::operator==(const dynamic_bitset &other) const {
+  return size_ == other.size_ &&
+         simd::equal(data(), other.data(), word_count());
+}
+
+inline std::string dynamic_bitset::to_string() const {
+  std::string result(size_, '0');
+  for (size_type i = find_first(); i < size_; i = find_next(i)) {
+    result[size_ - 1 - i] = '1';
+  }
+  return result;
+}
+
+inline void dynamic_bitset::trim() {
+  if (size_ % bits::kWordBits) {
+    words_[words_.size() - 1] &= bits::tail_mask(size_);
+  }
+}
+
+inline void dynamic_bitset::check_size(const dynamic_bitset &other) const {
+  if (size_ != other.size_) {
+    throw std::invalid_argument("bitset sizes differ");
+  }
+}
+
+inline dynamic_bitset operator&(dynamic_bitset a, const dynamic_bitset &b) {
+  return a &= b;
+}
+inline dynamic_bitset operator|(dynamic_bitset a, const dynamic_bitset &b) {
+  return a |= b;
+}
+inline dynamic_bitset operator^(dynamic_bitset a, const dynamic_bitset &b) {
+  return a ^= b;
+}
+
+// Битовое множество из N битов в s21::array слов; интерфейс тот же, что
+// у dynamic_bitset, без изменения длины
+template <size_t N>
+class bitset {
+  static_assert(N > 0, "bitset needs at least one bit");
+
+ public:
+  using value_type = bool;
+  using reference = bit_reference;
+  using const_reference = bool;
+  using size_type = size_t;
+  using iterator = bit_iterator<false>;
+  using const_iterator = bit_iterator<true>;
+
+  static constexpr size_type kWords = bits::words_for(N);
+
+  bitset() = default;
+
+  reference operator[](size_type pos) {
+    return reference(&words_[pos / bits::kWordBits], bit(pos));
+  }
+  bool operator[](size_type pos) const {
+    return (data()[pos / bits::kWordBits] & bit(pos)) != 0;
+  }
+  bool test(size_type pos) const {
+    if (pos >= N) throw std::out_of_range("Index out of range");
+    return (*this)[pos];
+  }
+  uint64_t *data() { return words_.data(); }
+  const uint64_t *data() const { return words_.data(); }
+  static constexpr size_type word_count() { return kWords; }
+
+  iterator begin() { return iterator(data(), 0); }
+  iterator end() { return iterator(data(), N); }
+  const_iterator begin() const { return const_iterator(data(), 0); }
+  const_iterator end() const { return const_iterator(data(), N); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  static constexpr size_type size() { return N; }
+
+  bitset &set() {
+    words_.fill(~uint64_t(0));
+    trim();
+    return *this;
+  }
+  bitset &set(size_type pos, bool value = true) {
+    if (pos >= N) throw std::out_of_range("Index out of range");
+    (*this)[pos] = value;
+    return *this;
+  }
+  bitset &reset() {
+    words_.fill(0);
+    return *this;
+  }
+  bitset &reset(size_type pos) { return set(pos, false); }
+  bitset &flip() {
+    simd::bit_not(data(), kWords);
+    trim();
+    return *this;
+  }
+  bitset &flip(size_type pos) {
+    if (pos >= N) throw std::out_of_range("Index out of range");
+    (*this)[pos].flip();
+    return *this;
+  }
+
+  size_type count() const { return simd::popcount(data(), kWords); }
+  bool any() const { return find_first() != N; }
+  bool none() const { return !any(); }
+  bool all() const { return count() == N; }
+  size_type find_first() const { return bits::find_from(data(), N, 0); }
+  size_type find_next(size_type pos) const {
+    return bits::find_from(data(), N, pos + 1);
+  }
+
+  bitset &operator&=(const bitset &other) {
+    simd::bit_and(data(), other.data(), kWords);
+    return *this;
+  }
+  bitset &operator|=(const bitset &other) {
+    simd::bit_or(data(), other.data(), kWords);
+    return *this;
+  }
+  bitset &operator^=(const bitset &other) {
+    simd::bit_xor(data(), other.data(), kWords);
+    return *this;
+  }
+  bitset &subtract(const bitset &other) {
+    simd::bit_and_not(data(), other.data(), kWords);
+    return *this;
+  }
+  bitset operator~() const { return bitset(*this).flip(); }
+  bool operator==(const bitset &other) const {
+    return simd::equal(data(), other.data(), kWords);
+  }
+  bool operator!=(const bitset &other) const { return !(*this == other); }
+  friend bitset operator&(bitset a, const bitset &b) { return a &= b; }
+  friend bitset operator|(bitset a, const bitset &b) { return a |= b; }
+  friend bitset operator^(bitset a, const bitset &b) { return a ^= b; }
+
+ private:
+  array<uint64_t, kWords> words_{};
+
+  static uint64_t bit(size_type pos) {
+    return uint64_t(1) << (pos % bits::kWordBits);
+  }
+  void trim() { words_[kWords - 1] &= bits::tail_mask(N); }
+};
+
+}  // namespace s21
+
+#endif  // SRC_S21_BITSET_HPP_
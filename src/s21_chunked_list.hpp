@@ -0,0 +1,481 @@
+#ifndef SRC_S21_CHUNKED_LIST_HPP_
+#define SRC_S21_CHUNKED_LIST_HPP_
+
+#include <initializer_list>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+
+// Развёрнутый список: каждый узел (chunk) хранит до N элементов подряд в
+// диапазоне [begin_, end_) своего массива. Проход по элементам идёт по
+// непрерывной памяти, служебные указатели делятся на N элементов. Пустых
+// узлов в списке нет. Перемещение T не должно бросать исключений
+template <class T, size_t N = (512 / sizeof(T) > 4 ? 512 / sizeof(T) : 4)>
+class chunked_list {
+  static_assert(N >= 2, "chunk must hold at least two elements");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+ private:
+  struct chunk {
+    chunk *prev_{nullptr};
+    chunk *next_{nullptr};
+    size_type begin_{0};
+    size_type end_{0};
+    alignas(T) unsigned char storage_[N * sizeof(T)];
+
+    T *at(size_type i) { return reinterpret_cast<T *>(storage_) + i; }
+    size_type size() const { return end_ - begin_; }
+  };
+
+ public:
+  class ChunkedIterator {
+   public:
+    chunk *chunk_;
+    size_type index_;
+
+    ChunkedIterator() : chunk_(nullptr), index_(0) {}
+    ChunkedIterator(chunk *one, size_type index)
+        : chunk_(one), index_(index) {}
+
+    // У последнего узла итератор остаётся на end_: это и есть end()
+    ChunkedIterator operator++() {
+      if (++index_ == chunk_->end_ && chunk_->next_) {
+        chunk_ = chunk_->next_;
+        index_ = chunk_->begin_;
+      }
+      return *this;
+    }
+    ChunkedIterator operator++(int) {
+      ChunkedIterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+    ChunkedIterator operator--() {
+      if (index_ == chunk_->begin_) {
+        chunk_ = chunk_->prev_;
+        index_ = chunk_->end_;
+      }
+      --index_;
+      return *this;
+    }
+    ChunkedIterator operator--(int) {
+      ChunkedIterator tmp = *this;
+      --*this;
+      return tmp;
+    }
+
+    bool operator!=(const ChunkedIterator &it) const {
+      return index_ != it.index_ || chunk_ != it.chunk_;
+    }
+    bool operator==(const ChunkedIterator &it) const { return !(*this != it); }
+
+    T &operator*() const { return *chunk_->at(index_); }
+    T *operator->() const { return chunk_->at(index_); }
+  };
+  using iterator = typename chunked_list::ChunkedIterator;
+
+  class ChunkedConstIterator {
+   public:
+    chunked_list::iterator citr;
+
+    ChunkedConstIterator() {}
+    explicit ChunkedConstIterator(const ChunkedIterator &other)
+        : citr(other) {}
+
+    ChunkedConstIterator operator++() {
+      ++citr;
+      return *this;
+    }
+    ChunkedConstIterator operator++(int) {
+      return ChunkedConstIterator(citr++);
+    }
+    ChunkedConstIterator operator--() {
+      --citr;
+      return *this;
+    }
+    ChunkedConstIterator operator--(int) {
+      return ChunkedConstIterator(citr--);
+    }
+
+    bool operator!=(const ChunkedConstIterator &it) const {
+      return citr != it.citr;
+    }
+    bool operator==(const ChunkedConstIterator &it) const {
+      return citr == it.citr;
+    }
+
+    const T &operator*() const { return *citr; }
+    const T *operator->() const { return &*citr; }
+  };
+  using const_iterator = typename chunked_list::ChunkedConstIterator;
+
+  chunked_list() {}
+  explicit chunked_list(std::initializer_list<value_type> const &items);
+  chunked_list(const chunked_list &l);
+  chunked_list(chunked_list &&l) { swap(l); }
+  ~chunked_list() { clear(); }
+  chunked_list &operator=(const chunked_list &l);
+  chunked_list &operator=(chunked_list &&l);
+
+  const_reference front() const;
+  const_reference back() const;
+
+  iterator begin() { return iterator(head_, head_ ? head_->begin_ : 0); }
+  iterator end() { return iterator(tail_, tail_ ? tail_->end_ : 0); }
+  const_iterator begin() const {
+    return const_iterator(const_cast<chunked_list *>(this)->begin());
+  }
+  const_iterator end() const {
+    return const_iterator(const_cast<chunked_list *>(this)->end());
+  }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(chunk) * N;
+  }
+  // Число узлов и вместимость одного узла
+  size_type chunk_count() const { return chunks_; }
+  static constexpr size_type chunk_capacity() { return N; }
+
+  void clear();
+  iterator insert(const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+  template <class... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
+  iterator erase(const_iterator pos);
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_front(const_reference value) { emplace_front(value); }
+  template <class... Args>
+  reference emplace_back(Args &&...args);
+  template <class... Args>
+  reference emplace_front(Args &&...args);
+  void pop_back();
+  void pop_front();
+  void swap(chunked_list &other);
+
+ private:
+  chunk *head_{nullptr};
+  chunk *tail_{nullptr};
+  size_type size_{0};
+  size_type chunks_{0};
+
+  void link_chunk(chunk *one, chunk *prev);
+  void free_chunk(chunk *one);
+  void split(chunk *&one, size_type &index);
+  void merge_next(chunk *one);
+};
+
+template <class T, size_t N>
+chunked_list<T, N>::chunked_list(
+    std::initializer_list<value_type> const &items) {
+  for (const auto &element : items) {
+    push_back(element);
+  }
+}
+
+template <class T, size_t N>
+chunked_list<T, N>::chunked_list(const chunked_list &l) {
+  try {
+    for (auto itr = l.cbegin(); itr != l.cend(); ++itr) push_back(*itr);
+  } catch (...) {
+    clear();
+    throw;
+  }
+}
+
+template <class T, size_t N>
+chunked_list<T, N> &chunked_list<T, N>::operator=(const chunked_list &l) {
+  if (this != &l) {
+    chunked_list tmp(l);
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <class T, size_t N>
+chunked_list<T, N> &chunked_list<T, N>::operator=(chunked_list &&l) {
+  if (this != &l) {
+    clear();
+    swap(l);
+  }
+  return *this;
+}
+
+template <class T, size_t N>
+typename chunked_list<T, N>::const_reference chunked_list<T, N>::front()
+    const {
+  if (!size_) throw std::out_of_range("Error, size = 0");
+  return *head_->at(head_->begin_);
+}
+
+template <class T, size_t N>
+typename chunked_list<T, N>::const_reference chunked_list<T, N>::back() const {
+  if (!size_) throw std::out_of_range("Error, size = 0");
+  return *tail_->at(tail_->end_ - 1);
+}
+
+template <class T, size_t N>
+void chunked_list<T, N>::clear() {
+  while (head_) {
+    chunk *next = head_->next_;
+    for (size_type i = head_->begin_; i < head_->end_; i++) head_->at(i)->~T();
+    delete head_;
+    head_ = next;
+  }
+  tail_ = nullptr;
+  size_ = 0;
+  chunks_ = 0;
+}
+
+// Вставка в узел сдвигает его элементы в сторону свободного места; полный
+// узел сначала делится пополам
+template <class T, size_t N>
+template <class... Args>
+typename chunked_list<T, N>::iterator chunked_list<T, N>::emplace(
+    const_iterator pos, Args &&...args) {
+  if (pos == cend()) {
+    emplace_back(std::forward<Args>(args)...);
+    return iterator(tail_, tail_->end_ - 1);
+  }
+  if (pos == cbegin()) {
+    emplace_front(std::forward<Args>(args)...);
+    return begin();
+  }
+  T value(std::forward<Args>(args)...);
+  chunk *one = pos.citr.chunk_;
+  size_type index = pos.citr.index_;
+  if (one->begin_ == 0 && one->end_ == N) split(one, index);
+  if (one->end_ < N) {
+    if (index == one->end_) {
+      new (one->at(index)) T(std::move(value));
+    } else {
+      new (one->at(one->end_)) T(std::move(*one->at(one->end_ - 1)));
+      for (size_type i = one->end_ - 1; i > index; i--) {
+        *one->at(i) = std::move(*one->at(i - 1));
+      }
+      *one->at(index) = std::move(value);
+    }
+    one->end_++;
+  } else {
+    if (index == one->begin_) {
+      new (one->at(index - 1)) T(std::move(value));
+    } else {
+      new (one->at(one->begin_ - 1)) T(std::move(*one->at(one->begin_)));
+      for (size_type i = one->begin_; i + 1 < index; i++) {
+        *one->at(i) = std::move(*one->at(i + 1));
+      }
+      *one->at(index - 1) = std::move(value);
+    }
+    one->begin_--;
+    index--;
+  }
+  size_++;
+  return iterator(one, index);
+}
+
+// Сдвигается меньшая часть узла. Узел, заполненный меньше чем на четверть,
+// сливается со следующим, если они помещаются в один
+template <class T, size_t N>
+typename chunked_list<T, N>::iterator chunked_list<T, N>::erase(
+    const_iterator pos) {
+  chunk *one = pos.citr.chunk_;
+  size_type index = pos.citr.index_;
+  if (index - one->begin_ < one->end_ - index - 1) {
+    for (size_type i = index; i > one->begin_; i--) {
+      *one->at(i) = std::move(*one->at(i - 1));
+    }
+    one->at(one->begin_)->~T();
+    one->begin_++;
+    index++;
+  } else {
+    for (size_type i = index; i + 1 < one->end_; i++) {
+      *one->at(i) = std::move(*one->at(i + 1));
+    }
+    one->end_--;
+    one->at(one->end_)->~T();
+  }
+  size_--;
+  chunk *next = one->next_;
+  if (one->begin_ == one->end_) {
+    free_chunk(one);
+    return next ? iterator(next, next->begin_) : end();
+  }
+  if (index == one->end_ && next) {
+    one = next;
+    index = next->begin_;
+  }
+  chunk *base = one == next ? one->prev_ : one;
+  if (base->size() < N / 4 && base->next_ &&
+      base->size() + base->next_->size() <= N) {
+    //  позиция в base и следующем узле как смещение от начала base
+    size_type offset = one == base
+                           ? index - base->begin_
+                           : base->size() + index - base->next_->begin_;
+    merge_next(base);
+    return iterator(base, base->begin_ + offset);
+  }
+  return iterator(one, index);
+}
+
+template <class T, size_t N>
+template <class... Args>
+typename chunked_list<T, N>::reference chunked_list<T, N>::emplace_back(
+    Args &&...args) {
+  if (tail_ && tail_->end_ < N) {
+    T *slot = new (tail_->at(tail_->end_)) T(std::forward<Args>(args)...);
+    tail_->end_++;
+    size_++;
+    return *slot;
+  }
+  chunk *one = new chunk;
+  try {
+    new (one->at(0)) T(std::forward<Args>(args)...);
+  } catch (...) {
+    delete one;
+    throw;
+  }
+  one->end_ = 1;
+  link_chunk(one, tail_);
+  size_++;
+  return *one->at(0);
+}
+
+template <class T, size_t N>
+template <class... Args>
+typename chunked_list<T, N>::reference chunked_list<T, N>::emplace_front(
+    Args &&...args) {
+  if (head_ && head_->begin_ > 0) {
+    T *slot = new (head_->at(head_->begin_ - 1)) T(std::forward<Args>(args)...);
+    head_->begin_--;
+    size_++;
+    return *slot;
+  }
+  //  новый узел заполняется с конца, чтобы следующие push_front шли в него
+  chunk *one = new chunk;
+  try {
+    new (one->at(N - 1)) T(std::forward<Args>(args)...);
+  } catch (...) {
+    delete one;
+    throw;
+  }
+  one->begin_ = N - 1;
+  one->end_ = N;
+  link_chunk(one, nullptr);
+  size_++;
+  return *one->at(N - 1);
+}
+
+template <class T, size_t N>
+void chunked_list<T, N>::pop_back() {
+  if (!size_) return;
+  tail_->end_--;
+  tail_->at(tail_->end_)->~T();
+  size_--;
+  if (tail_->begin_ == tail_->end_) free_chunk(tail_);
+}
+
+template <class T, size_t N>
+void chunked_list<T, N>::pop_front() {
+  if (!size_) return;
+  head_->at(head_->begin_)->~T();
+  head_->begin_++;
+  size_--;
+  if (head_->begin_ == head_->end_) free_chunk(head_);
+}
+
+template <class T, size_t N>
+void chunked_list<T, N>::swap(chunked_list &other) {
+  std::swap(head_, other.head_);
+  std::swap(tail_, other.tail_);
+  std::swap(size_, other.size_);
+  std::swap(chunks_, other.chunks_);
+}
+
+// Вставляет узел после prev, при prev == nullptr - в начало
+template <class T, size_t N>
+void chunked_list<T, N>::link_chunk(chunk *one, chunk *prev) {
+  one->prev_ = prev;
+  one->next_ = prev ? prev->next_ : head_;
+  if (one->next_) {
+    one->next_->prev_ = one;
+  } else {
+    tail_ = one;
+  }
+  if (prev) {
+    prev->next_ = one;
+  } else {
+    head_ = one;
+  }
+  chunks_++;
+}
+
+// Удаляет узел, элементы которого уже разрушены или перенесены
+template <class T, size_t N>
+void chunked_list<T, N>::free_chunk(chunk *one) {
+  if (one->prev_) {
+    one->prev_->next_ = one->next_;
+  } else {
+    head_ = one->next_;
+  }
+  if (one->next_) {
+    one->next_->prev_ = one->prev_;
+  } else {
+    tail_ = one->prev_;
+  }
+  delete one;
+  chunks_--;
+}
+
+// Переносит верхнюю половину полного узла в новый узел после него. one и
+// index переставляются на то же место среди элементов
+template <class T, size_t N>
+void chunked_list<T, N>::split(chunk *&one, size_type &index) {
+  chunk *half = new chunk;
+  size_type mid = one->begin_ + one->size() / 2;
+  for (size_type i = mid; i < one->end_; i++) {
+    new (half->at(half->end_++)) T(std::move(*one->at(i)));
+    one->at(i)->~T();
+  }
+  one->end_ = mid;
+  link_chunk(half, one);
+  if (index > mid) {
+    one = half;
+    index -= mid;
+  }
+}
+
+// Переносит элементы следующего узла в конец one и удаляет следующий узел
+template <class T, size_t N>
+void chunked_list<T, N>::merge_next(chunk *one) {
+  chunk *next = one->next_;
+  if (one->end_ + next->size() > N) {
+    size_type dst = 0;
+    for (size_type i = one->begin_; i < one->end_; i++, dst++) {
+      new (one->at(dst)) T(std::move(*one->at(i)));
+      one->at(i)->~T();
+    }
+    one->begin_ = 0;
+    one->end_ = dst;
+  }
+  for (size_type i = next->begin_; i < next->end_; i++) {
+    new (one->at(one->end_++)) T(std::move(*next->at(i)));
+    next->at(i)->~T();
+  }
+  free_chunk(next);
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_CHUNKED_LIST_HPP_
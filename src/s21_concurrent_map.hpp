@@ -0,0 +1,286 @@
+#ifndef SRC_S21_CONCURRENT_MAP_HPP_
+#define SRC_S21_CONCURRENT_MAP_HPP_
+
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "s21_map.hpp"
+#include "s21_vector.hpp"
+
+namespace s21 {
+
+namespace concurrent_detail {
+// Хешер сравним через ==
+template <class Hash, class = void>
+struct hash_comparable : std::false_type {};
+template <class Hash>
+struct hash_comparable<
+    Hash, std::void_t<decltype(std::declval<const Hash &>() ==
+                               std::declval<const Hash &>())>>
+    : std::true_type {};
+}  // namespace concurrent_detail
+
+// Потокобезопасный словарь: ключи распределены хешем по shard_count
+// независимым map, у каждой свой reader-writer замок. Чтения одной части
+// идут параллельно, записи блокируют только свою часть. Методы возвращают
+// копии значений: ссылка на элемент не пережила бы освобождение замка
+template <class Key, class T, class Hash = std::hash<Key>>
+class concurrent_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using size_type = size_t;
+
+  explicit concurrent_map(size_type shard_count = 16, const Hash &hash = Hash())
+      : shards_(new shard[shard_count ? shard_count : 1]),
+        shard_count_(shard_count ? shard_count : 1),
+        hash_(hash) {}
+  concurrent_map(const concurrent_map &) = delete;
+  concurrent_map &operator=(const concurrent_map &) = delete;
+  ~concurrent_map() { delete[] shards_; }
+
+  bool insert(const value_type &value) {
+    return insert(value.first, value.second);
+  }
+  // Вставляет элемент, если ключа ещё нет
+  bool insert(const Key &key, const T &obj);
+  void insert_or_assign(const Key &key, const T &obj);
+  bool erase(const Key &key);
+  // Копирует значение в value, если ключ есть
+  bool find(const Key &key, T &value) const;
+  bool contains(const Key &key) const;
+  // Вызывает f(T&) для значения под замком его части
+  template <class F>
+  bool update(const Key &key, F &&f);
+
+  size_type size() const;
+  bool empty() const { return size() == 0; }
+  void clear();
+  size_type shard_count() const { return shard_count_; }
+
+  // Параллельно по частям вызывает f(const Key&, const T&)
+  template <class F>
+  void for_each(F &&f) const;
+  // Переносит из other элементы, ключей которых ещё нет. Если ключи
+  // распределяются по частям одинаково (то же число частей и равные или
+  // не имеющие состояния хешеры), части сливаются попарно и параллельно
+  void merge(concurrent_map &other);
+
+ private:
+  // Выравнивание по линии кэша: замки соседних частей не делят строку
+  struct alignas(64) shard {
+    mutable std::shared_mutex mutex_;
+    mutable map<Key, T> map_;
+  };
+
+  shard *shards_;
+  size_type shard_count_;
+  Hash hash_;
+
+  shard &shard_for(const Key &key) const;
+  // Ключ попадает в части с одним номером в this и other
+  bool same_routing(const concurrent_map &other) const;
+  static void merge_shard(map<Key, T> &dst, map<Key, T> &src);
+  template <class F>
+  void parallel_shards(F &&f) const;
+};
+
+template <class Key, class T, class Hash>
+bool concurrent_map<Key, T, Hash>::insert(const Key &key, const T &obj) {
+  shard &part = shard_for(key);
+  std::unique_lock<std::shared_mutex> lock(part.mutex_);
+  return part.map_.insert(key, obj).second;
+}
+
+template <class Key, class T, class Hash>
+void concurrent_map<Key, T, Hash>::insert_or_assign(const Key &key,
+                                                    const T &obj) {
+  shard &part = shard_for(key);
+  std::unique_lock<std::shared_mutex> lock(part.mutex_);
+  auto res = part.map_.insert(key, obj);
+  if (!res.second) res.first->second = obj;
+}
+
+template <class Key, class T, class Hash>
+bool concurrent_map<Key, T, Hash>::erase(const Key &key) {
+  shard &part = shard_for(key);
+  std::unique_lock<std::shared_mutex> lock(part.mutex_);
+  auto it = part.map_.find(key);
+  if (it == part.map_.end()) return false;
+  part.map_.erase(it);
+  return true;
+}
+
+template <class Key, class T, class Hash>
+bool concurrent_map<Key, T, Hash>::find(const Key &key, T &value) const {
+  shard &part = shard_for(key);
+  std::shared_lock<std::shared_mutex> lock(part.mutex_);
+  auto it = part.map_.find(key);
+  if (it == part.map_.end()) return false;
+  value = it->second;
+  return true;
+}
+
+template <class Key, class T, class Hash>
+bool concurrent_map<Key, T, Hash>::contains(const Key &key) const {
+  shard &part = shard_for(key);
+  std::shared_lock<std::shared_mutex> lock(part.mutex_);
+  return part.map_.find(key) != part.map_.end();
+}
+
+template <class Key, class T, class Hash>
+template <class F>
+bool concurrent_map<Key, T, Hash>::update(const Key &key, F &&f) {
+  shard &part = shard_for(key);
+  std::unique_lock<std::shared_mutex> lock(part.mutex_);
+  auto it = part.map_.find(key);
+  if (it == part.map_.end()) return false;
+  f(it->second);
+  return true;
+}
+
+// Размеры частей читаются по очереди, поэтому при параллельных записях
+// результат - лишь оценка
+template <class Key, class T, class Hash>
+typename concurrent_map<Key, T, Hash>::size_type
+concurrent_map<Key, T, Hash>::size() const {
+  size_type total = 0;
+  for (size_type i = 0; i < shard_count_; i++) {
+    std::shared_lock<std::shared_mutex> lock(shards_[i].mutex_);
+    total += shards_[i].map_.size();
+  }
+  return total;
+}
+
+template <class Key, class T, class Hash>
+void concurrent_map<Key, T, Hash>::clear() {
+  parallel_shards([](shard &part) {
+    std::unique_lock<std::shared_mutex> lock(part.mutex_);
+    part.map_.clear();
+  });
+}
+
+template <class Key, class T, class Hash>
+template <class F>
+void concurrent_map<Key, T, Hash>::for_each(F &&f) const {
+  parallel_shards([&f](shard &part) {
+    std::shared_lock<std::shared_mutex> lock(part.mutex_);
+    for (auto it = part.map_.cbegin(); it != part.map_.cend(); ++it) {
+      f(it->first, it->second);
+    }
+  });
+}
+
+template <class Key, class T, class Hash>
+void concurrent_map<Key, T, Hash>::merge(concurrent_map &other) {
+  if (&other == this) return;
+  if (same_routing(other)) {
+    parallel_shards([this, &other](shard &part) {
+      shard &src = other.shards_[&part - shards_];
+      std::scoped_lock lock(part.mutex_, src.mutex_);
+      merge_shard(part.map_, src.map_);
+    });
+    return;
+  }
+  // Ключи части other переписываются под её разделяемой блокировкой, а
+  // каждый элемент переносится под scoped_lock обеих частей. Ни одна
+  // блокировка не держится в ожидании другой, поэтому встречные
+  // a.merge(b) и b.merge(a) не взаимоблокируются
+  for (size_type i = 0; i < other.shard_count_; i++) {
+    shard &src = other.shards_[i];
+    vector<Key> keys;
+    {
+      std::shared_lock<std::shared_mutex> lock(src.mutex_);
+      keys.reserve(src.map_.size());
+      for (auto it = src.map_.cbegin(); it != src.map_.cend(); ++it) {
+        keys.push_back(it->first);
+      }
+    }
+    for (const Key &key : keys) {
+      shard &dst = shard_for(key);
+      std::scoped_lock lock(dst.mutex_, src.mutex_);
+      auto it = src.map_.find(key);
+      if (it != src.map_.end() && dst.map_.insert(key, it->second).second) {
+        src.map_.erase(it);
+      }
+    }
+  }
+}
+
+template <class Key, class T, class Hash>
+typename concurrent_map<Key, T, Hash>::shard &
+concurrent_map<Key, T, Hash>::shard_for(const Key &key) const {
+  // Перемешивание старших бит: std::hash для целых - тождественная функция
+  size_t h = hash_(key);
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  return shards_[h % shard_count_];
+}
+
+template <class Key, class T, class Hash>
+bool concurrent_map<Key, T, Hash>::same_routing(
+    const concurrent_map &other) const {
+  if (other.shard_count_ != shard_count_) return false;
+  if constexpr (std::is_empty<Hash>::value) {
+    return true;
+  } else if constexpr (concurrent_detail::hash_comparable<Hash>::value) {
+    return static_cast<bool>(hash_ == other.hash_);
+  } else {
+    return false;
+  }
+}
+
+template <class Key, class T, class Hash>
+void concurrent_map<Key, T, Hash>::merge_shard(map<Key, T> &dst,
+                                               map<Key, T> &src) {
+  for (auto it = src.begin(); it != src.end();) {
+    auto cur = it;
+    ++it;
+    if (dst.insert(cur->first, cur->second).second) src.erase(cur);
+  }
+}
+
+// Раздаёт части потокам по кругу; исключение из любого потока
+// пробрасывается вызывающему после завершения всех потоков. Если поток не
+// создался, его части обходит вызывающий поток, а уже запущенные потоки
+// всё равно дожидаются join
+template <class Key, class T, class Hash>
+template <class F>
+void concurrent_map<Key, T, Hash>::parallel_shards(F &&f) const {
+  size_type threads = std::thread::hardware_concurrency();
+  if (!threads) threads = 1;
+  if (threads > shard_count_) threads = shard_count_;
+  std::exception_ptr error;
+  std::mutex error_mutex;
+  auto work = [&](size_type first) {
+    try {
+      for (size_type i = first; i < shard_count_; i += threads) f(shards_[i]);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(error_mutex);
+      if (!error) error = std::current_exception();
+    }
+  };
+  vector<std::thread> pool;
+  pool.reserve(threads - 1);
+  size_type started = 1;
+  try {
+    for (; started < threads; started++) pool.emplace_back(work, started);
+  } catch (...) {
+    // system_error или bad_alloc: оставшиеся части обходятся ниже
+  }
+  for (size_type t = started; t < threads; t++) work(t);
+  work(0);
+  for (std::thread &thread : pool) thread.join();
+  if (error) std::rethrow_exception(error);
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_CONCURRENT_MAP_HPP_
@@ -2,6 +2,22 @@
 #define SRC_S21_CONTAINERSPLUS_H_
 
 #include "s21_array.hpp"
+#include "s21_bitset.hpp"
+#include "s21_chunked_list.hpp"
+#include "s21_concurrent_map.hpp"
+#include "s21_intrusive_btree.hpp"
+#include "s21_intrusive_list.hpp"
+#include "s21_lru_cache.hpp"
+#include "s21_mmap_vector.hpp"
 #include "s21_multiset.hpp"
+#include "s21_parallel.hpp"
+#include "s21_radix_map.hpp"
+#include "s21_simd.hpp"
+#include "s21_slot_map.hpp"
+#include "s21_small_vector.hpp"
+#include "s21_soa_vector.hpp"
+#include "s21_sort.hpp"
+#include "s21_span.hpp"
+#include "s21_thread_pool.hpp"
 
 #endif  // SRC_S21_CONTAINERSPLUS_H_
@@ -0,0 +1,546 @@
+#ifndef SRC_S21_INTRUSIVE_BTREE_HPP_
+#define SRC_S21_INTRUSIVE_BTREE_HPP_
+
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_btree.hpp"
+
+namespace s21 {
+
+// Звено интрузивного дерева: те же left_/right_/parent_, что у btree_node,
+// и цвет для балансировки. Как и list_hook, объект наследует btree_hook<Tag>
+// для каждого дерева, копия объекта получает несвязанное звено
+template <class Tag = void>
+class btree_hook {
+ public:
+  btree_hook() {}
+  btree_hook(const btree_hook &) {}
+  btree_hook &operator=(const btree_hook &) { return *this; }
+  ~btree_hook() {}
+
+  bool is_linked() const { return parent_ != nullptr; }
+
+ private:
+  template <class T, class KeyOf, class OtherTag>
+  friend class intrusive_btree;
+
+  btree_hook *left_{nullptr};
+  btree_hook *right_{nullptr};
+  btree_hook *parent_{nullptr};
+  btree_color color_{red};
+};
+
+// Красно-чёрное дерево поиска по объектам, связанным через свои звенья
+// btree_hook<Tag>. Ключ объекта возвращает KeyOf, ключи сравниваются
+// оператором <, как в btree. Вставка и удаление не выделяют память и не
+// копируют объекты, высота дерева - O(log n).
+// Заголовок header_ служит end(): parent_ - корень, left_ - минимальный,
+// right_ - максимальный элемент, корень ссылается на header_ как на родителя
+template <class T, class KeyOf, class Tag = void>
+class intrusive_btree {
+ public:
+  using key_type =
+      std::decay_t<decltype(std::declval<KeyOf>()(std::declval<const T &>()))>;
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using hook = btree_hook<Tag>;
+
+  class IntrusiveIterator {
+   public:
+    hook *itr_;
+
+    IntrusiveIterator() : itr_(nullptr) {}
+    explicit IntrusiveIterator(hook *one) : itr_(one) {}
+
+    IntrusiveIterator operator++() {
+      itr_ = next(itr_);
+      return *this;
+    }
+    IntrusiveIterator operator++(int) {
+      IntrusiveIterator tmp = *this;
+      itr_ = next(itr_);
+      return tmp;
+    }
+    IntrusiveIterator operator--() {
+      itr_ = prev(itr_);
+      return *this;
+    }
+    IntrusiveIterator operator--(int) {
+      IntrusiveIterator tmp = *this;
+      itr_ = prev(itr_);
+      return tmp;
+    }
+
+    bool operator!=(const IntrusiveIterator &it) const {
+      return itr_ != it.itr_;
+    }
+    bool operator==(const IntrusiveIterator &it) const {
+      return itr_ == it.itr_;
+    }
+
+    T &operator*() const { return *static_cast<T *>(itr_); }
+    T *operator->() const { return static_cast<T *>(itr_); }
+  };
+  using iterator = typename intrusive_btree::IntrusiveIterator;
+
+  intrusive_btree() { reset_header(); }
+  intrusive_btree(const intrusive_btree &) = delete;
+  intrusive_btree(intrusive_btree &&t) : intrusive_btree() { swap(t); }
+  ~intrusive_btree() { clear(); }
+  intrusive_btree &operator=(const intrusive_btree &) = delete;
+  intrusive_btree &operator=(intrusive_btree &&t);
+
+  iterator begin() { return iterator(header_.left_); }
+  iterator end() { return iterator(&header_); }
+  static iterator iterator_to(T &value) { return iterator(as_hook(value)); }
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+
+  // Отвязывает все элементы, сами объекты не разрушаются
+  void clear();
+  // Связывает value, если элемента с таким ключом ещё нет
+  std::pair<iterator, bool> insert(T &value);
+  // Связывает value после всех элементов с равным ключом
+  iterator insert_equal(T &value);
+  // Отвязывает элемент, возвращает следующий
+  iterator erase(iterator pos);
+  void swap(intrusive_btree &other);
+
+  iterator find(const key_type &key);
+  bool contains(const key_type &key) { return find(key) != end(); }
+  // Первый элемент с ключом не меньше / больше key
+  iterator lower_bound(const key_type &key);
+  iterator upper_bound(const key_type &key);
+
+ private:
+  hook header_;
+  size_type size_{0};
+  KeyOf key_of_;
+
+  static hook *as_hook(T &value) { return static_cast<hook *>(&value); }
+  decltype(auto) key(hook *node) {
+    return key_of_(*static_cast<const T *>(node));
+  }
+  hook *&root() { return header_.parent_; }
+  void reset_header();
+  void link(hook *node, hook *parent, bool left);
+  void rotate_left(hook *node);
+  void rotate_right(hook *node);
+  static hook *minimum(hook *node);
+  static hook *maximum(hook *node);
+  static hook *next(hook *node);
+  static hook *prev(hook *node);
+};
+
+template <class T, class KeyOf, class Tag>
+intrusive_btree<T, KeyOf, Tag> &intrusive_btree<T, KeyOf, Tag>::operator=(
+    intrusive_btree &&t) {
+  if (this != &t) {
+    clear();
+    swap(t);
+  }
+  return *this;
+}
+
+// Обход в обратном порядке по указателям на родителя, без стека
+template <class T, class KeyOf, class Tag>
+void intrusive_btree<T, KeyOf, Tag>::clear() {
+  hook *node = root();
+  while (node) {
+    if (node->left_) {
+      node = node->left_;
+    } else if (node->right_) {
+      node = node->right_;
+    } else {
+      hook *parent = node->parent_ == &header_ ? nullptr : node->parent_;
+      if (parent) {
+        (parent->left_ == node ? parent->left_ : parent->right_) = nullptr;
+      }
+      node->parent_ = nullptr;
+      node->color_ = red;
+      node = parent;
+    }
+  }
+  reset_header();
+}
+
+template <class T, class KeyOf, class Tag>
+std::pair<typename intrusive_btree<T, KeyOf, Tag>::iterator, bool>
+intrusive_btree<T, KeyOf, Tag>::insert(T &value) {
+  hook *node = as_hook(value);
+  if (node->is_linked()) {
+    throw std::invalid_argument("element is already linked");
+  }
+  const key_type &new_key = key(node);
+  hook *parent = &header_;
+  hook *cur = root();
+  bool left = true;
+  while (cur) {
+    parent = cur;
+    left = new_key < key(cur);
+    cur = left ? cur->left_ : cur->right_;
+  }
+  //  равный ключ может быть только у предшественника места вставки
+  hook *before = left ? (parent == header_.left_ ? nullptr : prev(parent))
+                      : parent;
+  if (before && !(key(before) < new_key)) {
+    return {iterator(before), false};
+  }
+  link(node, parent, left);
+  return {iterator(node), true};
+}
+
+template <class T, class KeyOf, class Tag>
+typename intrusive_btree<T, KeyOf, Tag>::iterator
+intrusive_btree<T, KeyOf, Tag>::insert_equal(T &value) {
+  hook *node = as_hook(value);
+  if (node->is_linked()) {
+    throw std::invalid_argument("element is already linked");
+  }
+  const key_type &new_key = key(node);
+  hook *parent = &header_;
+  hook *cur = root();
+  bool left = true;
+  while (cur) {
+    parent = cur;
+    left = new_key < key(cur);
+    cur = left ? cur->left_ : cur->right_;
+  }
+  link(node, parent, left);
+  return iterator(node);
+}
+
+// Удаление с перебалансировкой: узел с двумя детьми меняется местами со
+// следующим за ним, данные при этом не копируются
+template <class T, class KeyOf, class Tag>
+typename intrusive_btree<T, KeyOf, Tag>::iterator
+intrusive_btree<T, KeyOf, Tag>::erase(iterator pos) {
+  hook *z = pos.itr_;
+  if (z == &header_) throw std::invalid_argument("attempt to erase end");
+  hook *result = next(z);
+  hook *y = z;
+  hook *x = nullptr;
+  hook *x_parent = nullptr;
+  if (!y->left_) {
+    x = y->right_;
+  } else if (!y->right_) {
+    x = y->left_;
+  } else {
+    y = minimum(y->right_);
+    x = y->right_;
+  }
+  if (y != z) {
+    //  y - следующий за z, встаёт на место z
+    z->left_->parent_ = y;
+    y->left_ = z->left_;
+    if (y != z->right_) {
+      x_parent = y->parent_;
+      if (x) x->parent_ = y->parent_;
+      y->parent_->left_ = x;
+      y->right_ = z->right_;
+      z->right_->parent_ = y;
+    } else {
+      x_parent = y;
+    }
+    if (root() == z) {
+      root() = y;
+    } else if (z->parent_->left_ == z) {
+      z->parent_->left_ = y;
+    } else {
+      z->parent_->right_ = y;
+    }
+    y->parent_ = z->parent_;
+    std::swap(y->color_, z->color_);
+    y = z;
+  } else {
+    x_parent = y->parent_;
+    if (x) x->parent_ = y->parent_;
+    if (root() == z) {
+      root() = x;
+    } else if (z->parent_->left_ == z) {
+      z->parent_->left_ = x;
+    } else {
+      z->parent_->right_ = x;
+    }
+    if (header_.left_ == z) {
+      header_.left_ = z->right_ ? minimum(x) : z->parent_;
+    }
+    if (header_.right_ == z) {
+      header_.right_ = z->left_ ? maximum(x) : z->parent_;
+    }
+  }
+  if (y->color_ == black) {
+    while (x != root() && (!x || x->color_ == black)) {
+      if (x == x_parent->left_) {
+        hook *w = x_parent->right_;
+        if (w->color_ == red) {
+          w->color_ = black;
+          x_parent->color_ = red;
+          rotate_left(x_parent);
+          w = x_parent->right_;
+        }
+        if ((!w->left_ || w->left_->color_ == black) &&
+            (!w->right_ || w->right_->color_ == black)) {
+          w->color_ = red;
+          x = x_parent;
+          x_parent = x_parent->parent_;
+        } else {
+          if (!w->right_ || w->right_->color_ == black) {
+            w->left_->color_ = black;
+            w->color_ = red;
+            rotate_right(w);
+            w = x_parent->right_;
+          }
+          w->color_ = x_parent->color_;
+          x_parent->color_ = black;
+          if (w->right_) w->right_->color_ = black;
+          rotate_left(x_parent);
+          break;
+        }
+      } else {
+        hook *w = x_parent->left_;
+        if (w->color_ == red) {
+          w->color_ = black;
+          x_parent->color_ = red;
+          rotate_right(x_parent);
+          w = x_parent->left_;
+        }
+        if ((!w->right_ || w->right_->color_ == black) &&
+            (!w->left_ || w->left_->color_ == black)) {
+          w->color_ = red;
+          x = x_parent;
+          x_parent = x_parent->parent_;
+        } else {
+          if (!w->left_ || w->left_->color_ == black) {
+            w->right_->color_ = black;
+            w->color_ = red;
+            rotate_left(w);
+            w = x_parent->left_;
+          }
+          w->color_ = x_parent->color_;
+          x_parent->color_ = black;
+          if (w->left_) w->left_->color_ = black;
+          rotate_right(x_parent);
+          break;
+        }
+      }
+    }
+    if (x) x->color_ = black;
+  }
+  z->left_ = z->right_ = z->parent_ = nullptr;
+  z->color_ = red;
+  size_--;
+  return iterator(result);
+}
+
+// header_ лежит внутри объекта: после обмена корень и пустой заголовок
+// перевешиваются на свой header_
+template <class T, class KeyOf, class Tag>
+void intrusive_btree<T, KeyOf, Tag>::swap(intrusive_btree &other) {
+  std::swap(header_.left_, other.header_.left_);
+  std::swap(header_.right_, other.header_.right_);
+  std::swap(header_.parent_, other.header_.parent_);
+  std::swap(size_, other.size_);
+  std::swap(key_of_, other.key_of_);
+  for (intrusive_btree *one : {this, &other}) {
+    if (one->size_) {
+      one->root()->parent_ = &one->header_;
+    } else {
+      one->reset_header();
+    }
+  }
+}
+
+template <class T, class KeyOf, class Tag>
+typename intrusive_btree<T, KeyOf, Tag>::iterator
+intrusive_btree<T, KeyOf, Tag>::find(const key_type &value) {
+  iterator pos = lower_bound(value);
+  if (pos == end() || value < key(pos.itr_)) return end();
+  return pos;
+}
+
+template <class T, class KeyOf, class Tag>
+typename intrusive_btree<T, KeyOf, Tag>::iterator
+intrusive_btree<T, KeyOf, Tag>::lower_bound(const key_type &value) {
+  hook *result = &header_;
+  for (hook *cur = root(); cur;) {
+    if (key(cur) < value) {
+      cur = cur->right_;
+    } else {
+      result = cur;
+      cur = cur->left_;
+    }
+  }
+  return iterator(result);
+}
+
+template <class T, class KeyOf, class Tag>
+typename intrusive_btree<T, KeyOf, Tag>::iterator
+intrusive_btree<T, KeyOf, Tag>::upper_bound(const key_type &value) {
+  hook *result = &header_;
+  for (hook *cur = root(); cur;) {
+    if (value < key(cur)) {
+      result = cur;
+      cur = cur->left_;
+    } else {
+      cur = cur->right_;
+    }
+  }
+  return iterator(result);
+}
+
+// Заголовок пустого дерева ссылается сам на себя, по красному цвету его
+// отличает prev()
+template <class T, class KeyOf, class Tag>
+void intrusive_btree<T, KeyOf, Tag>::reset_header() {
+  header_.parent_ = nullptr;
+  header_.left_ = header_.right_ = &header_;
+  header_.color_ = red;
+  size_ = 0;
+}
+
+// Подвешивает node к parent и восстанавливает свойства красно-чёрного дерева
+template <class T, class KeyOf, class Tag>
+void intrusive_btree<T, KeyOf, Tag>::link(hook *node, hook *parent,
+                                          bool left) {
+  node->parent_ = parent;
+  node->left_ = node->right_ = nullptr;
+  node->color_ = red;
+  if (parent == &header_) {
+    header_.parent_ = header_.left_ = header_.right_ = node;
+  } else if (left) {
+    parent->left_ = node;
+    if (parent == header_.left_) header_.left_ = node;
+  } else {
+    parent->right_ = node;
+    if (parent == header_.right_) header_.right_ = node;
+  }
+  size_++;
+  hook *x = node;
+  while (x != root() && x->parent_->color_ == red) {
+    hook *grand = x->parent_->parent_;
+    if (x->parent_ == grand->left_) {
+      hook *uncle = grand->right_;
+      if (uncle && uncle->color_ == red) {
+        x->parent_->color_ = black;
+        uncle->color_ = black;
+        grand->color_ = red;
+        x = grand;
+      } else {
+        if (x == x->parent_->right_) {
+          x = x->parent_;
+          rotate_left(x);
+        }
+        x->parent_->color_ = black;
+        grand->color_ = red;
+        rotate_right(grand);
+      }
+    } else {
+      hook *uncle = grand->left_;
+      if (uncle && uncle->color_ == red) {
+        x->parent_->color_ = black;
+        uncle->color_ = black;
+        grand->color_ = red;
+        x = grand;
+      } else {
+        if (x == x->parent_->left_) {
+          x = x->parent_;
+          rotate_right(x);
+        }
+        x->parent_->color_ = black;
+        grand->color_ = red;
+        rotate_left(grand);
+      }
+    }
+  }
+  root()->color_ = black;
+}
+
+template <class T, class KeyOf, class Tag>
+void intrusive_btree<T, KeyOf, Tag>::rotate_left(hook *node) {
+  hook *child = node->right_;
+  node->right_ = child->left_;
+  if (child->left_) child->left_->parent_ = node;
+  child->parent_ = node->parent_;
+  if (node == root()) {
+    root() = child;
+  } else if (node == node->parent_->left_) {
+    node->parent_->left_ = child;
+  } else {
+    node->parent_->right_ = child;
+  }
+  child->left_ = node;
+  node->parent_ = child;
+}
+
+template <class T, class KeyOf, class Tag>
+void intrusive_btree<T, KeyOf, Tag>::rotate_right(hook *node) {
+  hook *child = node->left_;
+  node->left_ = child->right_;
+  if (child->right_) child->right_->parent_ = node;
+  child->parent_ = node->parent_;
+  if (node == root()) {
+    root() = child;
+  } else if (node == node->parent_->right_) {
+    node->parent_->right_ = child;
+  } else {
+    node->parent_->left_ = child;
+  }
+  child->right_ = node;
+  node->parent_ = child;
+}
+
+template <class T, class KeyOf, class Tag>
+typename intrusive_btree<T, KeyOf, Tag>::hook *
+intrusive_btree<T, KeyOf, Tag>::minimum(hook *node) {
+  while (node->left_) node = node->left_;
+  return node;
+}
+
+template <class T, class KeyOf, class Tag>
+typename intrusive_btree<T, KeyOf, Tag>::hook *
+intrusive_btree<T, KeyOf, Tag>::maximum(hook *node) {
+  while (node->right_) node = node->right_;
+  return node;
+}
+
+// У максимального элемента подъём доходит до header_, его parent_ - корень
+template <class T, class KeyOf, class Tag>
+typename intrusive_btree<T, KeyOf, Tag>::hook *
+intrusive_btree<T, KeyOf, Tag>::next(hook *node) {
+  if (node->right_) return minimum(node->right_);
+  hook *parent = node->parent_;
+  while (node == parent->right_) {
+    node = parent;
+    parent = parent->parent_;
+  }
+  return node->right_ != parent ? parent : node;
+}
+
+// Из header_ (красный, его родитель-корень ссылается на него) переходим к
+// максимальному элементу
+template <class T, class KeyOf, class Tag>
+typename intrusive_btree<T, KeyOf, Tag>::hook *
+intrusive_btree<T, KeyOf, Tag>::prev(hook *node) {
+  if (node->color_ == red && node->parent_ &&
+      node->parent_->parent_ == node) {
+    return node->right_;
+  }
+  if (node->left_) return maximum(node->left_);
+  hook *parent = node->parent_;
+  while (node == parent->left_) {
+    node = parent;
+    parent = parent->parent_;
+  }
+  return parent;
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_INTRUSIVE_BTREE_HPP_
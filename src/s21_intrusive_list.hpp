@@ -0,0 +1,225 @@
+#ifndef SRC_S21_INTRUSIVE_LIST_HPP_
+#define SRC_S21_INTRUSIVE_LIST_HPP_
+
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+
+// Звено интрузивного списка. Объект наследует list_hook<Tag> для каждого
+// списка, в котором он может состоять; разные Tag позволяют одному объекту
+// быть сразу в нескольких списках. Копия объекта получает несвязанное
+// звено. Объект нельзя разрушать, пока он состоит в списке
+template <class Tag = void>
+class list_hook {
+ public:
+  list_hook() {}
+  list_hook(const list_hook &) {}
+  list_hook &operator=(const list_hook &) { return *this; }
+  ~list_hook() {}
+
+  bool is_linked() const { return next_ != nullptr; }
+
+ private:
+  template <class T, class OtherTag>
+  friend class intrusive_list;
+
+  list_hook *prev_{nullptr};
+  list_hook *next_{nullptr};
+};
+
+// Двусвязный список объектов, которые не копируются и не принадлежат
+// списку: элементы связываются через собственные звенья list_hook<Tag>.
+// Вставка и удаление не выделяют память. Кольцо замыкается через end_
+template <class T, class Tag = void>
+class intrusive_list {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using hook = list_hook<Tag>;
+
+  class IntrusiveIterator {
+   public:
+    hook *itr_;
+
+    IntrusiveIterator() : itr_(nullptr) {}
+    explicit IntrusiveIterator(hook *one) : itr_(one) {}
+
+    IntrusiveIterator operator++() {
+      itr_ = itr_->next_;
+      return *this;
+    }
+    IntrusiveIterator operator++(int) {
+      IntrusiveIterator tmp = *this;
+      itr_ = itr_->next_;
+      return tmp;
+    }
+    IntrusiveIterator operator--() {
+      itr_ = itr_->prev_;
+      return *this;
+    }
+    IntrusiveIterator operator--(int) {
+      IntrusiveIterator tmp = *this;
+      itr_ = itr_->prev_;
+      return tmp;
+    }
+
+    bool operator!=(const IntrusiveIterator &it) const {
+      return itr_ != it.itr_;
+    }
+    bool operator==(const IntrusiveIterator &it) const {
+      return itr_ == it.itr_;
+    }
+
+    T &operator*() const { return *static_cast<T *>(itr_); }
+    T *operator->() const { return static_cast<T *>(itr_); }
+  };
+  using iterator = typename intrusive_list::IntrusiveIterator;
+
+  intrusive_list() { end_.prev_ = end_.next_ = &end_; }
+  intrusive_list(const intrusive_list &) = delete;
+  intrusive_list(intrusive_list &&l) : intrusive_list() { swap(l); }
+  ~intrusive_list() { clear(); }
+  intrusive_list &operator=(const intrusive_list &) = delete;
+  intrusive_list &operator=(intrusive_list &&l);
+
+  reference front();
+  reference back();
+
+  iterator begin() { return iterator(end_.next_); }
+  iterator end() { return iterator(&end_); }
+  // Итератор на объект, который состоит в этом списке
+  static iterator iterator_to(T &value) { return iterator(as_hook(value)); }
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+
+  // Отвязывает все элементы, сами объекты не разрушаются
+  void clear();
+  // Вставляет value перед pos; value не должен состоять в списке с тем же Tag
+  iterator insert(iterator pos, T &value);
+  // Отвязывает элемент, возвращает следующий
+  iterator erase(iterator pos);
+  void push_back(T &value) { insert(end(), value); }
+  void push_front(T &value) { insert(begin(), value); }
+  void pop_back();
+  void pop_front();
+  void swap(intrusive_list &other);
+  // Переносит все элементы other перед pos без копирования
+  void splice(iterator pos, intrusive_list &other);
+
+ private:
+  hook end_;
+  size_type size_{0};
+
+  static hook *as_hook(T &value) { return static_cast<hook *>(&value); }
+};
+
+template <class T, class Tag>
+intrusive_list<T, Tag> &intrusive_list<T, Tag>::operator=(
+    intrusive_list &&l) {
+  if (this != &l) {
+    clear();
+    swap(l);
+  }
+  return *this;
+}
+
+template <class T, class Tag>
+typename intrusive_list<T, Tag>::reference intrusive_list<T, Tag>::front() {
+  if (!size_) throw std::out_of_range("Error, size = 0");
+  return *begin();
+}
+
+template <class T, class Tag>
+typename intrusive_list<T, Tag>::reference intrusive_list<T, Tag>::back() {
+  if (!size_) throw std::out_of_range("Error, size = 0");
+  return *iterator(end_.prev_);
+}
+
+template <class T, class Tag>
+void intrusive_list<T, Tag>::clear() {
+  hook *node = end_.next_;
+  while (node != &end_) {
+    hook *next = node->next_;
+    node->prev_ = node->next_ = nullptr;
+    node = next;
+  }
+  end_.prev_ = end_.next_ = &end_;
+  size_ = 0;
+}
+
+template <class T, class Tag>
+typename intrusive_list<T, Tag>::iterator intrusive_list<T, Tag>::insert(
+    iterator pos, T &value) {
+  hook *node = as_hook(value);
+  if (node->is_linked()) {
+    throw std::invalid_argument("element is already linked");
+  }
+  node->next_ = pos.itr_;
+  node->prev_ = pos.itr_->prev_;
+  pos.itr_->prev_->next_ = node;
+  pos.itr_->prev_ = node;
+  size_++;
+  return iterator(node);
+}
+
+template <class T, class Tag>
+typename intrusive_list<T, Tag>::iterator intrusive_list<T, Tag>::erase(
+    iterator pos) {
+  hook *node = pos.itr_;
+  if (node == &end_) throw std::invalid_argument("attempt to erase end");
+  hook *next = node->next_;
+  node->prev_->next_ = next;
+  next->prev_ = node->prev_;
+  node->prev_ = node->next_ = nullptr;
+  size_--;
+  return iterator(next);
+}
+
+template <class T, class Tag>
+void intrusive_list<T, Tag>::pop_back() {
+  if (size_) erase(iterator(end_.prev_));
+}
+
+template <class T, class Tag>
+void intrusive_list<T, Tag>::pop_front() {
+  if (size_) erase(begin());
+}
+
+// end_ лежит внутри объекта: после обмена крайние элементы перевешиваются
+template <class T, class Tag>
+void intrusive_list<T, Tag>::swap(intrusive_list &other) {
+  std::swap(end_.prev_, other.end_.prev_);
+  std::swap(end_.next_, other.end_.next_);
+  std::swap(size_, other.size_);
+  for (intrusive_list *one : {this, &other}) {
+    if (one->size_) {
+      one->end_.next_->prev_ = &one->end_;
+      one->end_.prev_->next_ = &one->end_;
+    } else {
+      one->end_.prev_ = one->end_.next_ = &one->end_;
+    }
+  }
+}
+
+template <class T, class Tag>
+void intrusive_list<T, Tag>::splice(iterator pos, intrusive_list &other) {
+  if (&other == this || other.empty()) return;
+  hook *first = other.end_.next_;
+  hook *last = other.end_.prev_;
+  first->prev_ = pos.itr_->prev_;
+  pos.itr_->prev_->next_ = first;
+  last->next_ = pos.itr_;
+  pos.itr_->prev_ = last;
+  size_ += other.size_;
+  other.size_ = 0;
+  other.end_.prev_ = other.end_.next_ = &other.end_;
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_INTRUSIVE_LIST_HPP_
@@ -1,6 +1,9 @@
 #ifndef SRC_S21_LIST_HPP_
 #define SRC_S21_LIST_HPP_
 
+#include <type_traits>
+#include <utility>
+
 namespace s21 {
 
 template <typename T>
@@ -11,41 +14,46 @@ class list {
   using const_reference = const T &;
   using size_type = size_t;
 
-  //  CLASS SINGLY LINKED LIST
-  class listNode {
+  //  CLASS NODE LINKS
+  //  Общая часть узла и элемента за последним (end), у которого нет данных
+  class listNodeBase {
+   public:
+    listNodeBase *pNext;
+    listNodeBase *pPrev;
+
+    listNodeBase() : pNext(nullptr), pPrev(nullptr) {}
+    listNodeBase(listNodeBase *pNext, listNodeBase *pPrev)
+        : pNext(pNext), pPrev(pPrev) {}
+  };
+  using NodeBase = typename list<T>::listNodeBase;
+
+  //  CLASS DOUBLY LINKED LIST NODE
+  class listNode : public listNodeBase {
    public:
     T data;
-    listNode *pNext;
-    listNode *pPrev;
-
-    listNode() : data(), pNext(nullptr), pPrev(nullptr) {}
-    explicit listNode(T const &data = T(), listNode *pNext = nullptr,
-                      listNode *pPrev = nullptr) {
-      this->data = data;
-      this->pNext = pNext;
-      this->pPrev = pPrev;
-    }
-    ~listNode() { free_memory(); }
-    inline void free_memory() {
-      pNext = nullptr;
-      pPrev = nullptr;
-    }
+
+    //  данные строятся на месте из аргументов конструктора T
+    template <class... Args>
+    explicit listNode(Args &&...args)
+        : listNodeBase(), data(std::forward<Args>(args)...) {}
   };
   using Node = typename list<T>::listNode;
 
   //  CLASS ITERATOR
   class ListIterator {
    public:
-    Node *itr;
+    NodeBase *itr;
 
     ListIterator() { itr = nullptr; }
     explicit ListIterator(const list<T> &other) { itr = other.head_; }
+    explicit ListIterator(NodeBase *node) { itr = node; }
     ~ListIterator() { itr = nullptr; }
+    //  у end нет следующего узла, только у него pNext == nullptr
     inline T &operator*() {
-      if (itr == nullptr) {
+      if (itr == nullptr || itr->pNext == nullptr) {
         throw std::invalid_argument("attempt to dereference a null pointer");
       }
-      return itr->data;
+      return static_cast<Node *>(itr)->data;
     }
     inline ListIterator operator++(int) {
       if (itr == nullptr) {
@@ -142,39 +150,71 @@ class list {
 
   inline void clear();
   iterator insert(iterator pos, const_reference value);
-  void erase(iterator pos);
+  iterator insert(iterator pos, size_type count, const_reference value);
+  template <class InputIt,
+            std::enable_if_t<!std::is_integral<InputIt>::value, int> = 0>
+  iterator insert(iterator pos, InputIt first, InputIt last);
+  iterator insert(iterator pos, std::initializer_list<value_type> items);
+  iterator erase(iterator pos);
+  iterator erase(iterator first, iterator last);
   void push_back(const_reference value);
   void pop_back();
   void push_front(const_reference value);
   void pop_front();
   void swap(list &other);
-  inline void merge(list &other);
+  void merge(list &other);
+  template <class Compare>
+  void merge(list &other, Compare comp);
   void splice(const_iterator pos, list &other);
-  inline void reverse();
-  void unique();
+  void reverse();
+  size_type unique();
+  template <class BinaryPredicate>
+  size_type unique(BinaryPredicate pred);
+  size_type remove(const_reference value);
+  template <class UnaryPredicate>
+  size_type remove_if(UnaryPredicate pred);
   void sort();
+  template <class Compare>
+  void sort(Compare comp);
 
   template <class... Args>
   iterator emplace(const_iterator pos, Args &&...args);
   template <class... Args>
-  void emplace_back(Args &&...args);
+  reference emplace_back(Args &&...args);
+  template <class... Args>
+  reference emplace_front(Args &&...args);
+  template <class... Args>
+  iterator insert_many(const_iterator pos, Args &&...args);
+  template <class... Args>
+  void insert_many_back(Args &&...args);
   template <class... Args>
-  void emplace_front(Args &&...args);
+  void insert_many_front(Args &&...args);
 
  private:
   size_t size_;
-  Node *head_;
+  //  первый узел, для пустого списка - &end_
+  NodeBase *head_;
+  //  элемент за последним: end_.pPrev - последний узел, end_.pNext всегда
+  //  nullptr
+  NodeBase end_;
   iterator last_elem();
   inline const_iterator clast_elem();
+  void link_before(NodeBase *pos, NodeBase *node);
+  iterator splice_range(iterator pos, list &other);
+  void unlink(NodeBase *node);
+  void relink_end();
+  void relink_prev();
+  template <class Compare>
+  static NodeBase *merge_chains(NodeBase *one, NodeBase *two, Compare &comp);
 };
 
 template <typename T>
-list<T>::list() : size_(0), head_(nullptr) {}
+list<T>::list() : size_(0), head_(&end_), end_() {}
 
 template <typename T>
-list<T>::list(size_t n) : size_(0), head_(nullptr) {
+list<T>::list(size_t n) : list() {
   while (n != size_) {
-    push_back(value_type());
+    emplace_back();
   }
 }
 
@@ -187,20 +227,14 @@ list<T>::list(std::initializer_list<value_type> const &items) : list() {
 
 template <typename T>
 list<T>::list(const list &l) : list() {
-  if (l.size_) {
-    list<T>::iterator tmp(l);
-    while (tmp.itr->pNext != nullptr) {
-      push_back(*tmp);
-      ++tmp;
-    }
-    push_back(*tmp);
+  for (NodeBase *node = l.head_; node != &l.end_; node = node->pNext) {
+    push_back(static_cast<Node *>(node)->data);
   }
 }
 
 template <typename T>
-list<T>::list(list &&l) : size_(l.size_), head_(l.head_) {
-  l.head_ = nullptr;
-  l.size_ = 0;
+list<T>::list(list &&l) : list() {
+  swap(l);
 }
 
 template <typename T>
@@ -211,38 +245,30 @@ list<T>::~list() {
 template <typename T>
 list<T> &list<T>::operator=(list &&l) {
   clear();
-  head_ = l.head_;
-  size_ = l.size_;
-  l.head_ = nullptr;
-  l.size_ = 0;
+  swap(l);
   return *this;
 }
 
 template <typename T>
 typename list<T>::const_reference list<T>::front() {
   if (!size_) throw std::out_of_range("Error, size = 0");
-  list<T>::iterator tmp(*this);
-  return *tmp;
+  return static_cast<Node *>(head_)->data;
 }
 
 template <typename T>
 typename list<T>::const_reference list<T>::back() {
   if (!size_) throw std::out_of_range("Error, size = 0");
-  list<T>::iterator tmp(*this);
-  while (tmp.itr->pNext != nullptr) ++tmp;
-  return *tmp;
+  return static_cast<Node *>(end_.pPrev)->data;
 }
 
 template <typename T>
 typename list<T>::iterator list<T>::begin() {
-  return iterator(*this);
+  return iterator(head_);
 }
 
 template <typename T>
 typename list<T>::iterator list<T>::end() {
-  iterator tmp = last_elem();
-  ++tmp;
-  return tmp;
+  return iterator(&end_);
 }
 
 template <typename T>
@@ -257,7 +283,7 @@ typename list<T>::const_iterator list<T>::cend() {
 
 template <typename T>
 bool list<T>::empty() {
-  return head_ == nullptr;
+  return size_ == 0;
 }
 
 template <typename T>
@@ -280,122 +306,127 @@ void list<T>::clear() {
 template <typename T>
 typename list<T>::iterator list<T>::insert(list<T>::iterator pos,
                                            list<T>::const_reference value) {
-  if (pos == begin()) {
-    push_front(value);
-    pos = begin();
-  } else if (pos.itr->pNext == nullptr) {
-    push_back(value);
-    ++pos;
-  } else {
-    iterator tmp = begin();
-    ++tmp;
-    iterator rab = begin();
-    while (pos.itr != tmp.itr) {
-      ++tmp;
-      ++rab;
-    }
-    --tmp;
-    rab.itr->pNext = new Node(value);
-    ++rab;
-    rab.itr->pNext = pos.itr;
-    rab.itr->pPrev = tmp.itr;
-    pos.itr->pPrev = tmp.itr->pNext;
-    size_++;
-    pos = rab;
+  return emplace((const_iterator)pos, value);
+}
+
+template <typename T>
+typename list<T>::iterator list<T>::insert(list<T>::iterator pos,
+                                           size_type count,
+                                           list<T>::const_reference value) {
+  list<T> tmp;
+  for (; count; count--) {
+    tmp.push_back(value);
   }
-  return pos;
+  return splice_range(pos, tmp);
 }
 
+// Элементы сначала собираются во временный список: если конструктор
+// бросит исключение, исходный список не изменится
 template <typename T>
-void list<T>::erase(list<T>::iterator pos) {
-  if (pos == begin()) {
-    pop_front();
-  } else if (pos.itr->pNext == nullptr) {
-    pop_back();
-  } else {
-    iterator tmp = begin();
-    ++tmp;
-    iterator rab = begin();
-    while (pos.itr != tmp.itr) {
-      ++tmp;
-      ++rab;
-    }
-    ++tmp;
-    rab.itr->pNext = pos.itr->pNext;
-    tmp.itr->pPrev = pos.itr->pPrev;
-    delete pos.itr;
-    size_--;
+template <class InputIt,
+          std::enable_if_t<!std::is_integral<InputIt>::value, int>>
+typename list<T>::iterator list<T>::insert(list<T>::iterator pos,
+                                           InputIt first, InputIt last) {
+  list<T> tmp;
+  for (; first != last; ++first) {
+    tmp.push_back(*first);
   }
+  return splice_range(pos, tmp);
 }
 
 template <typename T>
-void list<T>::push_back(list<T>::const_reference value) {
-  if (!size_) {
-    head_ = new Node(value);
-  } else {
-    Node *current = head_;
-    while (current->pNext != nullptr) {
-      current = current->pNext;
-    }
-    current->pNext = new Node(value, nullptr, current);
+typename list<T>::iterator list<T>::insert(
+    list<T>::iterator pos, std::initializer_list<value_type> items) {
+  return insert(pos, items.begin(), items.end());
+}
+
+template <typename T>
+typename list<T>::iterator list<T>::erase(list<T>::iterator pos) {
+  if (pos.itr == nullptr || pos.itr->pNext == nullptr) {
+    throw std::invalid_argument("attempt to erase end of list");
   }
-  size_++;
+  NodeBase *next = pos.itr->pNext;
+  unlink(pos.itr);
+  delete static_cast<Node *>(pos.itr);
+  return iterator(next);
+}
+
+// Удаляет [first, last), возвращает last
+template <typename T>
+typename list<T>::iterator list<T>::erase(list<T>::iterator first,
+                                          list<T>::iterator last) {
+  while (first != last) {
+    first = erase(first);
+  }
+  return last;
+}
+
+template <typename T>
+void list<T>::push_back(list<T>::const_reference value) {
+  emplace_back(value);
 }
 
 template <typename T>
 void list<T>::pop_back() {
   if (!size_) return;
-  if (size_ == 1) {
-    pop_front();
-  } else {
-    Node *current = head_;
-    for (size_t i = 0; i < size_ - 2; i++) {
-      current = current->pNext;
-    }
-    Node *tmp = current->pNext;
-    current->pNext = nullptr;
-    delete tmp;
-    size_--;
-  }
+  NodeBase *tmp = end_.pPrev;
+  unlink(tmp);
+  delete static_cast<Node *>(tmp);
 }
 
 template <typename T>
 void list<T>::push_front(list<T>::const_reference value) {
-  if (!size_) {
-    head_ = new Node(value);
-  } else {
-    Node *current = new Node(value, head_, nullptr);
-    head_->pPrev = current;
-    head_ = current;
-  }
-  size_++;
+  emplace_front(value);
 }
 
 template <typename T>
 void list<T>::pop_front() {
   if (!size_) return;
-  Node *tmp = head_;
-  head_ = head_->pNext;
-  if (size_ != 1) head_->pPrev = nullptr;
-  delete tmp;
-  size_--;
+  NodeBase *tmp = head_;
+  unlink(tmp);
+  delete static_cast<Node *>(tmp);
 }
 
+// end_ лежит внутри объекта, поэтому после обмена последние узлы
+// перевешиваются на свой end_
 template <typename T>
 void list<T>::swap(list &other) {
-  Node *tmp = head_;
+  NodeBase *tmp = head_;
   head_ = other.head_;
   other.head_ = tmp;
+  tmp = end_.pPrev;
+  end_.pPrev = other.end_.pPrev;
+  other.end_.pPrev = tmp;
   size_t tmp_size = size_;
   size_ = other.size_;
   other.size_ = tmp_size;
+  relink_end();
+  other.relink_end();
 }
 
 template <typename T>
 void list<T>::merge(list &other) {
-  const_iterator tmp = cend();
-  splice(tmp, other);
-  sort();
+  merge(other,
+        [](const_reference one, const_reference two) { return one < two; });
+}
+
+// Слияние двух отсортированных списков за один проход: узлы other
+// перецепляются в этот список, при равенстве первыми идут элементы этого
+template <typename T>
+template <class Compare>
+void list<T>::merge(list &other, Compare comp) {
+  if (&other == this || other.size_ == 0) return;
+  NodeBase *one = nullptr;
+  if (size_) {
+    end_.pPrev->pNext = nullptr;
+    one = head_;
+  }
+  other.end_.pPrev->pNext = nullptr;
+  head_ = merge_chains(one, other.head_, comp);
+  size_ += other.size_;
+  other.size_ = 0;
+  other.relink_end();
+  relink_prev();
 }
 
 template <typename T>
@@ -403,124 +434,199 @@ void list<T>::splice(list<T>::const_iterator pos, list &other) {
   if (other.size_ == 0) {
     return;
   }
-  if (pos == cbegin()) {
-    Node *temp = head_;
-    head_ = other.head_;
-    iterator tmp = other.last_elem();
-    tmp.itr->pNext = temp;
-    temp->pPrev = tmp.itr;
-  } else if (pos == cend()) {
-    iterator tmp = last_elem();
-    tmp.itr->pNext = other.head_;
-    other.head_->pPrev = tmp.itr;
+  NodeBase *first = other.head_;
+  NodeBase *last = other.end_.pPrev;
+  NodeBase *next = pos.citr.itr;
+  first->pPrev = next->pPrev;
+  if (next->pPrev) {
+    next->pPrev->pNext = first;
   } else {
-    const_iterator tmp = cbegin();
-    ++tmp;
-    const_iterator rab = cbegin();
-    while (pos.citr.itr != tmp.citr.itr) {
-      ++tmp;
-      ++rab;
-    }
-    rab.citr.itr->pNext = other.head_;
-    tmp = other.clast_elem();
-    pos.citr.itr->pPrev = tmp.citr.itr;
-    tmp.citr.itr->pNext = pos.citr.itr;
-    other.head_->pPrev = rab.citr.itr;
+    head_ = first;
   }
-  other.head_ = nullptr;
+  last->pNext = next;
+  next->pPrev = last;
   size_ += other.size_;
   other.size_ = 0;
+  other.relink_end();
 }
 
+// Меняет местами pNext и pPrev у каждого узла
 template <typename T>
 void list<T>::reverse() {
-  list<T> tmp(std::move(*this));
-  for (iterator itr = tmp.begin(); itr != tmp.end(); ++itr) {
-    push_front(*itr);
+  if (size_ < 2) return;
+  NodeBase *first = head_;
+  NodeBase *last = end_.pPrev;
+  for (NodeBase *node = first; node != &end_;) {
+    NodeBase *next = node->pNext;
+    node->pNext = node->pPrev;
+    node->pPrev = next;
+    node = next;
   }
+  head_ = last;
+  last->pPrev = nullptr;
+  first->pNext = &end_;
+  end_.pPrev = first;
+}
+
+template <typename T>
+typename list<T>::size_type list<T>::unique() {
+  return unique(
+      [](const_reference one, const_reference two) { return one == two; });
 }
 
+// Удаляет элементы, для которых pred(предыдущий оставшийся, элемент)
+// истинно, возвращает число удалённых
 template <typename T>
-void list<T>::unique() {
-  iterator one = begin();
-  iterator two = begin();
-  ++two;
-  while (two.itr->pNext != nullptr) {
-    if (*one == *two) {
-      iterator tmp = two;
-      ++two;
-      erase(tmp);
+template <class BinaryPredicate>
+typename list<T>::size_type list<T>::unique(BinaryPredicate pred) {
+  size_type removed = 0;
+  if (size_ < 2) return removed;
+  NodeBase *prev = head_;
+  for (NodeBase *node = head_->pNext; node != &end_;) {
+    NodeBase *next = node->pNext;
+    if (pred(static_cast<Node *>(prev)->data,
+             static_cast<Node *>(node)->data)) {
+      unlink(node);
+      delete static_cast<Node *>(node);
+      removed++;
     } else {
-      ++one;
-      ++two;
+      prev = node;
     }
+    node = next;
   }
-  if (*one == *two) {
-    erase(two);
+  return removed;
+}
+
+// value может ссылаться на элемент самого списка, поэтому его узел
+// удаляется последним
+template <typename T>
+typename list<T>::size_type list<T>::remove(const_reference value) {
+  size_type removed = 0;
+  NodeBase *deferred = nullptr;
+  for (NodeBase *node = head_; node != &end_;) {
+    NodeBase *next = node->pNext;
+    if (static_cast<Node *>(node)->data == value) {
+      unlink(node);
+      if (&static_cast<Node *>(node)->data == &value) {
+        deferred = node;
+      } else {
+        delete static_cast<Node *>(node);
+      }
+      removed++;
+    }
+    node = next;
+  }
+  delete static_cast<Node *>(deferred);
+  return removed;
+}
+
+template <typename T>
+template <class UnaryPredicate>
+typename list<T>::size_type list<T>::remove_if(UnaryPredicate pred) {
+  size_type removed = 0;
+  for (NodeBase *node = head_; node != &end_;) {
+    NodeBase *next = node->pNext;
+    if (pred(static_cast<Node *>(node)->data)) {
+      unlink(node);
+      delete static_cast<Node *>(node);
+      removed++;
+    }
+    node = next;
   }
+  return removed;
 }
 
 template <typename T>
 void list<T>::sort() {
-  if (size_ > 1) {
-    iterator one = begin();
-    iterator two = begin();
-    for (size_type i = 0; i < size_; ++i, ++one) {
-      two = begin();
-      size_type k = 0;
-      while (k < i) {
-        ++k;
-        ++two;
-      }
-      for (size_type j = i; j < size_; ++j, ++two) {
-        if (*one > *two) {
-          auto tmp = *two;
-          *two = *one;
-          *one = tmp;
-        }
-      }
+  sort([](const_reference one, const_reference two) { return one < two; });
+}
+
+// Восходящая сортировка слиянием: узлы цепляются по pNext в отсортированные
+// серии длиной 2^i, серии равной длины сливаются. Данные не копируются,
+// память не выделяется, равные элементы сохраняют порядок
+template <typename T>
+template <class Compare>
+void list<T>::sort(Compare comp) {
+  if (size_ < 2) return;
+  NodeBase *runs[64] = {};
+  size_type max_run = 0;
+  end_.pPrev->pNext = nullptr;
+  NodeBase *node = head_;
+  while (node) {
+    NodeBase *carry = node;
+    node = node->pNext;
+    carry->pNext = nullptr;
+    size_type i = 0;
+    //  runs[i] содержит более ранние элементы, поэтому идёт первым
+    for (; runs[i]; i++) {
+      carry = merge_chains(runs[i], carry, comp);
+      runs[i] = nullptr;
     }
+    runs[i] = carry;
+    if (i > max_run) max_run = i;
+  }
+  NodeBase *result = nullptr;
+  for (size_type i = 0; i <= max_run; i++) {
+    if (runs[i]) result = merge_chains(runs[i], result, comp);
   }
+  head_ = result;
+  relink_prev();
 }
 
+// Строит один элемент на месте перед pos
 template <typename T>
 template <class... Args>
 typename list<T>::iterator list<T>::emplace(list<T>::const_iterator pos,
                                             Args &&...args) {
-  iterator res = pos.citr;
-  for (auto &element : {args...}) {
-    res = insert(res, element);
-    ++res;
+  if (pos.citr.itr == nullptr) {
+    throw std::invalid_argument("attempt to dereference a null pointer");
   }
-  --res;
-  return res;
+  NodeBase *node = new Node(std::forward<Args>(args)...);
+  link_before(pos.citr.itr, node);
+  return iterator(node);
 }
 
 template <typename T>
 template <class... Args>
-void list<T>::emplace_back(Args &&...args) {
-  for (auto &element : {args...}) {
-    push_back(element);
-  }
+typename list<T>::reference list<T>::emplace_back(Args &&...args) {
+  Node *node = new Node(std::forward<Args>(args)...);
+  link_before(&end_, node);
+  return node->data;
 }
 
 template <typename T>
 template <class... Args>
-void list<T>::emplace_front(Args &&...args) {
-  for (auto &element : {args...}) {
-    push_front(element);
-  }
+typename list<T>::reference list<T>::emplace_front(Args &&...args) {
+  Node *node = new Node(std::forward<Args>(args)...);
+  link_before(head_, node);
+  return node->data;
+}
+
+// Вставляет по элементу на каждый аргумент перед pos, возвращает последний
+// вставленный
+template <typename T>
+template <class... Args>
+typename list<T>::iterator list<T>::insert_many(list<T>::const_iterator pos,
+                                                Args &&...args) {
+  (emplace(pos, std::forward<Args>(args)), ...);
+  return --pos.citr;
+}
+
+template <typename T>
+template <class... Args>
+void list<T>::insert_many_back(Args &&...args) {
+  (emplace_back(std::forward<Args>(args)), ...);
+}
+
+template <typename T>
+template <class... Args>
+void list<T>::insert_many_front(Args &&...args) {
+  (emplace_front(std::forward<Args>(args)), ...);
 }
 
 template <typename T>
 typename list<T>::iterator list<T>::last_elem() {
-  iterator tmp(*this);
-  if (tmp.itr != nullptr) {
-    while (tmp.itr->pNext != nullptr) {
-      ++tmp;
-    }
-  }
-  return tmp;
+  return iterator(end_.pPrev);
 }
 
 template <typename T>
@@ -528,6 +634,87 @@ typename list<T>::const_iterator list<T>::clast_elem() {
   return (const_iterator)last_elem();
 }
 
+// Вставляет узел перед pos, pos может быть &end_
+template <typename T>
+void list<T>::link_before(NodeBase *pos, NodeBase *node) {
+  node->pNext = pos;
+  node->pPrev = pos->pPrev;
+  if (pos->pPrev) {
+    pos->pPrev->pNext = node;
+  } else {
+    head_ = node;
+  }
+  pos->pPrev = node;
+  size_++;
+}
+
+// Исключает узел из цепочки, не удаляя его. За любым узлом есть хотя бы end_
+template <typename T>
+void list<T>::unlink(NodeBase *node) {
+  if (node->pPrev) {
+    node->pPrev->pNext = node->pNext;
+  } else {
+    head_ = node->pNext;
+  }
+  node->pNext->pPrev = node->pPrev;
+  size_--;
+}
+
+// splice, возвращающий первый перенесённый элемент или pos
+template <typename T>
+typename list<T>::iterator list<T>::splice_range(iterator pos, list &other) {
+  iterator first = other.empty() ? pos : other.begin();
+  splice((const_iterator)pos, other);
+  return first;
+}
+
+// Сливает две отсортированные цепочки по pNext, оканчивающиеся nullptr. Из
+// two элемент берётся только если он строго меньше: слияние устойчиво
+template <typename T>
+template <class Compare>
+typename list<T>::NodeBase *list<T>::merge_chains(NodeBase *one,
+                                                  NodeBase *two,
+                                                  Compare &comp) {
+  NodeBase head;
+  NodeBase *tail = &head;
+  while (one && two) {
+    if (comp(static_cast<Node *>(two)->data, static_cast<Node *>(one)->data)) {
+      tail->pNext = two;
+      two = two->pNext;
+    } else {
+      tail->pNext = one;
+      one = one->pNext;
+    }
+    tail = tail->pNext;
+  }
+  tail->pNext = one ? one : two;
+  return head.pNext;
+}
+
+// Восстанавливает pPrev и end_ по цепочке pNext от head_, оканчивающейся
+// nullptr
+template <typename T>
+void list<T>::relink_prev() {
+  NodeBase *prev = nullptr;
+  for (NodeBase *node = head_; node; node = node->pNext) {
+    node->pPrev = prev;
+    prev = node;
+  }
+  prev->pNext = &end_;
+  end_.pPrev = prev;
+}
+
+// Восстанавливает связи с end_ по size_, head_ и end_.pPrev
+template <typename T>
+void list<T>::relink_end() {
+  if (size_) {
+    end_.pPrev->pNext = &end_;
+  } else {
+    head_ = &end_;
+    end_.pPrev = nullptr;
+  }
+}
+
 }  // namespace s21
 
 #endif  // SRC_S21_LIST_HPP_
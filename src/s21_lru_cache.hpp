@@ -0,0 +1,500 @@
+#ifndef SRC_S21_LRU_CACHE_HPP_
+#define SRC_S21_LRU_CACHE_HPP_
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "s21_vector.hpp"
+
+namespace s21 {
+
+// Счётчики обращений к кэшу
+struct cache_stats {
+  size_t hits{0};
+  size_t misses{0};
+  size_t evictions{0};
+};
+
+namespace cache_detail {
+
+// Индекс кэшей: хеш-таблица с цепочками поверх s21::vector. Узлы
+// выделяются по одному и не двигаются при росте таблицы, поэтому на них
+// держатся указатели списков вытеснения. Node хранит key_, hash_ и
+// chain_ - следующий узел корзины. Таблица владеет узлами
+template <class Key, class Node, class Hash = std::hash<Key>>
+class hash_index {
+ public:
+  hash_index() = default;
+  hash_index(const hash_index &) = delete;
+  hash_index &operator=(const hash_index &) = delete;
+  ~hash_index() { clear(); }
+
+  Node *find(const Key &key) const;
+  // Принимает узел с ключом, которого ещё нет в таблице
+  Node *insert(Node *node);
+  // Вынимает узел из таблицы и удаляет его
+  void erase(Node *node);
+  void clear();
+  size_t size() const { return size_; }
+
+ private:
+  vector<Node *> buckets_;
+  size_t size_{0};
+  unsigned bits_{0};
+  Hash hash_;
+
+  // Фибоначчиево перемешивание: последовательные и кратные степени двойки
+  // ключи расходятся по разным корзинам
+  size_t slot(size_t hash) const {
+    return static_cast<size_t>((uint64_t(hash) * 0x9E3779B97F4A7C15ull) >>
+                               (64 - bits_));
+  }
+  void grow();
+};
+
+template <class Key, class Node, class Hash>
+Node *hash_index<Key, Node, Hash>::find(const Key &key) const {
+  if (!size_) return nullptr;
+  size_t hash = hash_(key);
+  for (Node *node = buckets_[slot(hash)]; node; node = node->chain_) {
+    if (node->hash_ == hash && node->key_ == key) return node;
+  }
+  return nullptr;
+}
+
+template <class Key, class Node, class Hash>
+Node *hash_index<Key, Node, Hash>::insert(Node *node) {
+  std::unique_ptr<Node> owned(node);
+  if (size_ + 1 > buckets_.size()) grow();
+  node->hash_ = hash_(node->key_);
+  Node *&head = buckets_[slot(node->hash_)];
+  node->chain_ = head;
+  head = owned.release();
+  ++size_;
+  return node;
+}
+
+template <class Key, class Node, class Hash>
+void hash_index<Key, Node, Hash>::erase(Node *node) {
+  Node **link = &buckets_[slot(node->hash_)];
+  while (*link != node) link = &(*link)->chain_;
+  *link = node->chain_;
+  --size_;
+  delete node;
+}
+
+template <class Key, class Node, class Hash>
+void hash_index<Key, Node, Hash>::clear() {
+  for (Node *&head : buckets_) {
+    while (head) {
+      Node *next = head->chain_;
+      delete head;
+      head = next;
+    }
+  }
+  size_ = 0;
+}
+
+// Удваивает число корзин и раскладывает узлы заново по сохранённым хешам
+template <class Key, class Node, class Hash>
+void hash_index<Key, Node, Hash>::grow() {
+  unsigned bits = bits_ ? bits_ + 1 : 4;
+  vector<Node *> buckets(size_t(1) << bits);
+  buckets_.swap(buckets);
+  bits_ = bits;
+  for (Node *head : buckets) {
+    while (head) {
+      Node *next = head->chain_;
+      Node *&target = buckets_[slot(head->hash_)];
+      head->chain_ = target;
+      target = head;
+      head = next;
+    }
+  }
+}
+
+}  // namespace cache_detail
+
+// Кэш ограниченного размера с вытеснением давно не использованных
+// элементов. Элементы найдены через хеш-таблицу, порядок использования
+// хранится интрузивным двусвязным списком внутри самих элементов, поэтому
+// get, put и вытеснение - O(1) в среднем, без спуска по дереву и прохода
+// по списку
+template <class Key, class T>
+class lru_cache {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using size_type = size_t;
+  using eviction_callback = std::function<void(const Key &, T &)>;
+
+  explicit lru_cache(size_type capacity,
+                     eviction_callback on_evict = eviction_callback())
+      : capacity_(capacity), on_evict_(std::move(on_evict)) {}
+  lru_cache(const lru_cache &) = delete;
+  lru_cache &operator=(const lru_cache &) = delete;
+  ~lru_cache() {}
+
+  // Значение по ключу или nullptr; найденный элемент становится самым новым
+  T *get(const Key &key);
+  // Вставляет или обновляет значение, при переполнении вытесняет самый
+  // старый элемент
+  void put(const Key &key, const T &value);
+  bool erase(const Key &key);
+  void clear();
+  // Проверка наличия без изменения порядка и счётчиков
+  bool contains(const Key &key) { return entries_.find(key) != nullptr; }
+
+  size_type size() { return entries_.size(); }
+  bool empty() { return entries_.size() == 0; }
+  size_type capacity() const { return capacity_; }
+  void set_capacity(size_type capacity);
+
+  const cache_stats &stats() const { return stats_; }
+  void reset_stats() { stats_ = cache_stats(); }
+
+ private:
+  struct lru_entry {
+    Key key_;
+    T value_;
+    size_t hash_{0};
+    lru_entry *chain_{nullptr};
+    lru_entry *prev_{nullptr};
+    lru_entry *next_{nullptr};
+  };
+
+  cache_detail::hash_index<Key, lru_entry> entries_;
+  // head_ - самый новый элемент, tail_ - кандидат на вытеснение
+  lru_entry *head_{nullptr};
+  lru_entry *tail_{nullptr};
+  size_type capacity_;
+  eviction_callback on_evict_;
+  cache_stats stats_;
+
+  void unlink(lru_entry *entry);
+  void push_front(lru_entry *entry);
+  void evict();
+};
+
+template <class Key, class T>
+T *lru_cache<Key, T>::get(const Key &key) {
+  lru_entry *entry = entries_.find(key);
+  if (!entry) {
+    ++stats_.misses;
+    return nullptr;
+  }
+  ++stats_.hits;
+  if (entry != head_) {
+    unlink(entry);
+    push_front(entry);
+  }
+  return &entry->value_;
+}
+
+template <class Key, class T>
+void lru_cache<Key, T>::put(const Key &key, const T &value) {
+  lru_entry *entry = entries_.find(key);
+  if (entry) {
+    entry->value_ = value;
+    if (entry != head_) {
+      unlink(entry);
+      push_front(entry);
+    }
+    return;
+  }
+  if (!capacity_) return;
+  if (entries_.size() == capacity_) evict();
+  push_front(entries_.insert(new lru_entry{key, value}));
+}
+
+template <class Key, class T>
+bool lru_cache<Key, T>::erase(const Key &key) {
+  lru_entry *entry = entries_.find(key);
+  if (!entry) return false;
+  unlink(entry);
+  entries_.erase(entry);
+  return true;
+}
+
+template <class Key, class T>
+void lru_cache<Key, T>::clear() {
+  entries_.clear();
+  head_ = nullptr;
+  tail_ = nullptr;
+}
+
+// Уменьшение ёмкости сразу вытесняет лишние элементы
+template <class Key, class T>
+void lru_cache<Key, T>::set_capacity(size_type capacity) {
+  capacity_ = capacity;
+  while (entries_.size() > capacity_) evict();
+}
+
+template <class Key, class T>
+void lru_cache<Key, T>::unlink(lru_entry *entry) {
+  if (entry->prev_) {
+    entry->prev_->next_ = entry->next_;
+  } else {
+    head_ = entry->next_;
+  }
+  if (entry->next_) {
+    entry->next_->prev_ = entry->prev_;
+  } else {
+    tail_ = entry->prev_;
+  }
+  entry->prev_ = nullptr;
+  entry->next_ = nullptr;
+}
+
+template <class Key, class T>
+void lru_cache<Key, T>::push_front(lru_entry *entry) {
+  entry->next_ = head_;
+  if (head_) {
+    head_->prev_ = entry;
+  } else {
+    tail_ = entry;
+  }
+  head_ = entry;
+}
+
+// Элемент уходит из индекса, даже если обработчик бросил исключение: из
+// списка он уже убран и иначе остался бы найденным, но без места в порядке
+template <class Key, class T>
+void lru_cache<Key, T>::evict() {
+  lru_entry *entry = tail_;
+  unlink(entry);
+  ++stats_.evictions;
+  if (on_evict_) {
+    try {
+      on_evict_(entry->key_, entry->value_);
+    } catch (...) {
+      entries_.erase(entry);
+      throw;
+    }
+  }
+  entries_.erase(entry);
+}
+
+// Кэш с вытеснением наименее часто используемых элементов. Элементы с
+// одинаковой частотой собраны в корзину со своим списком в порядке
+// использования, корзины упорядочены по возрастанию частоты. Вытесняется
+// самый старый элемент корзины с минимальной частотой
+template <class Key, class T>
+class lfu_cache {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using size_type = size_t;
+  using eviction_callback = std::function<void(const Key &, T &)>;
+
+  explicit lfu_cache(size_type capacity,
+                     eviction_callback on_evict = eviction_callback())
+      : capacity_(capacity), on_evict_(std::move(on_evict)) {}
+  lfu_cache(const lfu_cache &) = delete;
+  lfu_cache &operator=(const lfu_cache &) = delete;
+  ~lfu_cache() { clear(); }
+
+  // Значение по ключу или nullptr; у найденного элемента растёт частота
+  T *get(const Key &key);
+  void put(const Key &key, const T &value);
+  bool erase(const Key &key);
+  void clear();
+  bool contains(const Key &key) { return entries_.find(key) != nullptr; }
+  // Сколько раз элемент был вставлен или прочитан, 0 - если его нет
+  size_type frequency(const Key &key);
+
+  size_type size() { return entries_.size(); }
+  bool empty() { return entries_.size() == 0; }
+  size_type capacity() const { return capacity_; }
+  void set_capacity(size_type capacity);
+
+  const cache_stats &stats() const { return stats_; }
+  void reset_stats() { stats_ = cache_stats(); }
+
+ private:
+  struct lfu_bucket;
+  struct lfu_entry {
+    Key key_;
+    T value_;
+    size_t hash_{0};
+    lfu_entry *chain_{nullptr};
+    lfu_bucket *bucket_{nullptr};
+    lfu_entry *prev_{nullptr};
+    lfu_entry *next_{nullptr};
+  };
+  struct lfu_bucket {
+    size_type freq_{0};
+    lfu_entry *head_{nullptr};
+    lfu_entry *tail_{nullptr};
+    lfu_bucket *prev_{nullptr};
+    lfu_bucket *next_{nullptr};
+  };
+
+  cache_detail::hash_index<Key, lfu_entry> entries_;
+  lfu_bucket *min_bucket_{nullptr};
+  size_type capacity_;
+  eviction_callback on_evict_;
+  cache_stats stats_;
+
+  void touch(lfu_entry *entry);
+  void attach(lfu_entry *entry, lfu_bucket *bucket);
+  void detach(lfu_entry *entry);
+  lfu_bucket *bucket_after(lfu_bucket *prev, size_type freq);
+  void evict();
+};
+
+template <class Key, class T>
+T *lfu_cache<Key, T>::get(const Key &key) {
+  lfu_entry *entry = entries_.find(key);
+  if (!entry) {
+    ++stats_.misses;
+    return nullptr;
+  }
+  ++stats_.hits;
+  touch(entry);
+  return &entry->value_;
+}
+
+template <class Key, class T>
+void lfu_cache<Key, T>::put(const Key &key, const T &value) {
+  lfu_entry *entry = entries_.find(key);
+  if (entry) {
+    entry->value_ = value;
+    touch(entry);
+    return;
+  }
+  if (!capacity_) return;
+  if (entries_.size() == capacity_) evict();
+  entry = entries_.insert(new lfu_entry{key, value});
+  lfu_bucket *first = min_bucket_;
+  if (!first || first->freq_ != 1) {
+    try {
+      first = bucket_after(nullptr, 1);
+    } catch (...) {
+      entries_.erase(entry);
+      throw;
+    }
+  }
+  attach(entry, first);
+}
+
+template <class Key, class T>
+bool lfu_cache<Key, T>::erase(const Key &key) {
+  lfu_entry *entry = entries_.find(key);
+  if (!entry) return false;
+  detach(entry);
+  entries_.erase(entry);
+  return true;
+}
+
+template <class Key, class T>
+void lfu_cache<Key, T>::clear() {
+  while (min_bucket_) {
+    lfu_bucket *next = min_bucket_->next_;
+    delete min_bucket_;
+    min_bucket_ = next;
+  }
+  entries_.clear();
+}
+
+template <class Key, class T>
+typename lfu_cache<Key, T>::size_type lfu_cache<Key, T>::frequency(
+    const Key &key) {
+  lfu_entry *entry = entries_.find(key);
+  return entry ? entry->bucket_->freq_ : 0;
+}
+
+template <class Key, class T>
+void lfu_cache<Key, T>::set_capacity(size_type capacity) {
+  capacity_ = capacity;
+  while (entries_.size() > capacity_) evict();
+}
+
+// Переносит элемент в корзину со следующей частотой
+template <class Key, class T>
+void lfu_cache<Key, T>::touch(lfu_entry *entry) {
+  lfu_bucket *bucket = entry->bucket_;
+  lfu_bucket *next = bucket->next_;
+  if (!next || next->freq_ != bucket->freq_ + 1) {
+    next = bucket_after(bucket, bucket->freq_ + 1);
+  }
+  detach(entry);
+  attach(entry, next);
+}
+
+template <class Key, class T>
+void lfu_cache<Key, T>::attach(lfu_entry *entry, lfu_bucket *bucket) {
+  entry->bucket_ = bucket;
+  entry->prev_ = nullptr;
+  entry->next_ = bucket->head_;
+  if (bucket->head_) {
+    bucket->head_->prev_ = entry;
+  } else {
+    bucket->tail_ = entry;
+  }
+  bucket->head_ = entry;
+}
+
+// Убирает элемент из корзины, опустевшая корзина удаляется
+template <class Key, class T>
+void lfu_cache<Key, T>::detach(lfu_entry *entry) {
+  lfu_bucket *bucket = entry->bucket_;
+  if (entry->prev_) {
+    entry->prev_->next_ = entry->next_;
+  } else {
+    bucket->head_ = entry->next_;
+  }
+  if (entry->next_) {
+    entry->next_->prev_ = entry->prev_;
+  } else {
+    bucket->tail_ = entry->prev_;
+  }
+  entry->bucket_ = nullptr;
+  if (bucket->head_) return;
+  if (bucket->prev_) {
+    bucket->prev_->next_ = bucket->next_;
+  } else {
+    min_bucket_ = bucket->next_;
+  }
+  if (bucket->next_) bucket->next_->prev_ = bucket->prev_;
+  delete bucket;
+}
+
+// Создаёт пустую корзину с частотой freq сразу после prev (в начале, если
+// prev нет)
+template <class Key, class T>
+typename lfu_cache<Key, T>::lfu_bucket *lfu_cache<Key, T>::bucket_after(
+    lfu_bucket *prev, size_type freq) {
+  auto *bucket = new lfu_bucket;
+  bucket->freq_ = freq;
+  bucket->prev_ = prev;
+  bucket->next_ = prev ? prev->next_ : min_bucket_;
+  if (bucket->next_) bucket->next_->prev_ = bucket;
+  if (prev) {
+    prev->next_ = bucket;
+  } else {
+    min_bucket_ = bucket;
+  }
+  return bucket;
+}
+
+template <class Key, class T>
+void lfu_cache<Key, T>::evict() {
+  lfu_entry *entry = min_bucket_->tail_;
+  detach(entry);
+  ++stats_.evictions;
+  if (on_evict_) {
+    try {
+      on_evict_(entry->key_, entry->value_);
+    } catch (...) {
+      entries_.erase(entry);
+      throw;
+    }
+  }
+  entries_.erase(entry);
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_LRU_CACHE_HPP_
@@ -1,6 +1,8 @@
 #ifndef SRC_S21_MAP_HPP_
 #define SRC_S21_MAP_HPP_
 
+#include "s21_small_vector.hpp"
+
 namespace s21 {
 template <typename Key, typename T>
 class map {
@@ -13,22 +15,16 @@ class map {
   using size_type = size_t;
   class MapNode {
    public:
-    Key key_;
-    T value_;
+    value_type data_;
     MapNode *left_;
     MapNode *right_;
     MapNode *parent_;
 
-    MapNode()
-        : key_(), value_(), left_(nullptr), right_(nullptr), parent_(nullptr) {}
+    MapNode() : data_(), left_(nullptr), right_(nullptr), parent_(nullptr) {}
     explicit MapNode(Key const &key = Key(), T const &value = T(),
                      MapNode *left = nullptr, MapNode *right = nullptr,
                      MapNode *parent = nullptr)
-        : key_(key),
-          value_(value),
-          left_(left),
-          right_(right),
-          parent_(parent) {}
+        : data_(key, value), left_(left), right_(right), parent_(parent) {}
     ~MapNode() {
       left_ = nullptr;
       right_ = nullptr;
@@ -44,78 +40,54 @@ class map {
     Node *itr_;
     Node *itrhead_;
     MapIterator() : first_(), end_(), itr_(), itrhead_() {}
-    explicit MapIterator(const map<Key, T> &one) {
-      if (one.head_->left_) {
-        first_ = one.head_->left_;
+    explicit MapIterator(const map<Key, T> &one)
+        : first_(one.head_), end_(one.head_), itr_(), itrhead_(one.head_) {
+      if (first_) {
         while (first_->left_) {
           first_ = first_->left_;
         }
-      } else {
-        first_ = one.head_;
-      }
-      if (one.head_->right_) {
-        end_ = one.head_->right_;
         while (end_->right_) {
           end_ = end_->right_;
         }
-      } else {
-        end_ = one.head_;
       }
       itr_ = first_;
-      itrhead_ = one.head_;
     }
 
+    // Переход по связям узлов без сравнения ключей, после последнего
+    // элемента итератор указывает на nullptr (end)
     MapIterator operator++() {
-      if (itr_ == end_) {
-        itr_ = end_->right_;
-        return *this;
-      }
-      Node *tmp = itr_;
-      while (!tmp->right_) {
-        tmp = tmp->parent_;
-        if (itr_->key_ < tmp->key_) {
-          itr_ = tmp;
-          return *this;
+      if (itr_->right_) {
+        itr_ = itr_->right_;
+        while (itr_->left_) {
+          itr_ = itr_->left_;
         }
+        return *this;
       }
-      while (tmp->key_ < itr_->key_) {
+      Node *tmp = itr_->parent_;
+      while (tmp && tmp->right_ == itr_) {
+        itr_ = tmp;
         tmp = tmp->parent_;
-        if (itr_->key_ < tmp->key_) {
-          itr_ = tmp;
-          return *this;
-        }
-      }
-      tmp = tmp->right_;
-      while (tmp->left_) {
-        tmp = tmp->left_;
       }
       itr_ = tmp;
       return *this;
     }
 
     MapIterator operator--() {
-      if (itr_ == end_->right_) {
+      if (!itr_) {
         itr_ = end_;
         return *this;
       }
-      Node *tmp = itr_;
-      while (!tmp->left_) {
-        tmp = tmp->parent_;
-        if (itr_->key_ > tmp->key_) {
-          itr_ = tmp;
-          return *this;
+      if (itr_->left_) {
+        itr_ = itr_->left_;
+        while (itr_->right_) {
+          itr_ = itr_->right_;
         }
+        return *this;
       }
-      while (tmp->key_ > itr_->key_) {
+      Node *tmp = itr_->parent_;
+      while (tmp && tmp->left_ == itr_) {
+        itr_ = tmp;
         tmp = tmp->parent_;
-        if (itr_->key_ > tmp->key_) {
-          itr_ = tmp;
-          return *this;
-        }
-      }
-      tmp = tmp->left_;
-      while (tmp->right_) {
-        tmp = tmp->right_;
       }
       itr_ = tmp;
       return *this;
@@ -124,9 +96,8 @@ class map {
     bool operator!=(const MapIterator &it) { return itr_ != it.itr_; }
     bool operator==(const MapIterator &it) { return itr_ == it.itr_; }
 
-    std::pair<Key, T> operator*() const {
-      return std::make_pair(itr_->key_, itr_->value_);
-    }
+    reference operator*() const { return itr_->data_; }
+    value_type *operator->() const { return &itr_->data_; }
 
     ~MapIterator() {
       first_ = nullptr;
@@ -136,17 +107,48 @@ class map {
   };
   using iterator = typename map<Key, T>::MapIterator;
 
+  class MapConstIterator {
+   public:
+    map::iterator citr;
+
+    MapConstIterator() {}
+    explicit MapConstIterator(const map<Key, T> &one) : citr(one) {}
+    explicit MapConstIterator(const MapIterator &other) : citr(other) {}
+    ~MapConstIterator() {}
+
+    MapConstIterator operator++() {
+      ++citr;
+      return *this;
+    }
+    MapConstIterator operator--() {
+      --citr;
+      return *this;
+    }
+
+    bool operator!=(const MapConstIterator &it) { return citr != it.citr; }
+    bool operator==(const MapConstIterator &it) { return citr == it.citr; }
+
+    const_reference operator*() const { return *citr; }
+    const value_type *operator->() const { return &*citr; }
+  };
+  using const_iterator = typename map<Key, T>::MapConstIterator;
+
   map();
   explicit map(std::initializer_list<value_type> const &items);
   map(const map &m);
   map(map &&m);
   ~map();
-  map operator=(map &&m);
+  map &operator=(const map &m);
+  map &operator=(map &&m);
   T &at(const Key &key);
   T &operator[](const Key &key);
 
   iterator begin();
   iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const;
+  const_iterator cend() const;
   bool empty();
   size_type size();
   size_type max_size();
@@ -158,14 +160,16 @@ class map {
   void swap(map &other);
   void merge(map &other);
   bool contains(const Key &key);
+  iterator find(const Key &key);
 
   template <class... Args>
-  std::vector<std::pair<iterator, bool>> emplace(Args &&...args);
+  small_vector<std::pair<iterator, bool>> emplace(Args &&...args);
 
  private:
   Node *head_;
   size_t size_;
-  void copy(Node *cp);
+  void copy(const Node *cp);
+  void replace_node(Node *node, Node *child);
 };
 
 // Конструктор по умолчанию, создает пустой map
@@ -199,9 +203,20 @@ map<Key, T>::~map() {
   clear();
 }
 
+// Перегрузка оператора присваивания копированием
+template <typename Key, typename T>
+map<Key, T> &map<Key, T>::operator=(const map &m) {
+  if (this != &m) {
+    clear();
+    copy(m.head_);
+  }
+  return *this;
+}
+
 // Перегрузка оператора присваивания для движущегося объекта
 template <typename Key, typename T>
-map<Key, T> map<Key, T>::operator=(map &&m) {
+map<Key, T> &map<Key, T>::operator=(map &&m) {
+  if (this == &m) return *this;
   clear();
   head_ = m.head_;
   size_ = m.size_;
@@ -214,30 +229,30 @@ map<Key, T> map<Key, T>::operator=(map &&m) {
 template <typename Key, typename T>
 T &map<Key, T>::at(const Key &key) {
   Node *tmp = head_;
-  while (key != tmp->key_) {
-    if (tmp->right_ && key > tmp->key_) {
+  while (key != tmp->data_.first) {
+    if (tmp->right_ && key > tmp->data_.first) {
       tmp = tmp->right_;
-    } else if (tmp->left_ && key < tmp->key_) {
+    } else if (tmp->left_ && key < tmp->data_.first) {
       tmp = tmp->left_;
     } else {
       throw std::out_of_range("The key does not exist, out of the map!");
     }
   }
-  return tmp->value_;
+  return tmp->data_.second;
 }
 
 // Получить доступ или вставить указанный элемент
 template <typename Key, typename T>
 T &map<Key, T>::operator[](const Key &key) {
   Node *tmp = head_;
-  while (key != tmp->key_) {
-    if (key > tmp->key_) {
+  while (key != tmp->data_.first) {
+    if (key > tmp->data_.first) {
       tmp = tmp->right_;
     } else {
       tmp = tmp->left_;
     }
   }
-  return tmp->value_;
+  return tmp->data_.second;
 }
 
 // Возвращает итератор в начало
@@ -251,11 +266,32 @@ typename map<Key, T>::iterator map<Key, T>::begin() {
 template <typename Key, typename T>
 typename map<Key, T>::iterator map<Key, T>::end() {
   iterator tmp(*this);
-  tmp.itr_ = tmp.end_;
-  ++tmp;
+  tmp.itr_ = nullptr;
   return tmp;
 }
 
+template <typename Key, typename T>
+typename map<Key, T>::const_iterator map<Key, T>::begin() const {
+  return const_iterator(*this);
+}
+
+template <typename Key, typename T>
+typename map<Key, T>::const_iterator map<Key, T>::end() const {
+  const_iterator tmp(*this);
+  tmp.citr.itr_ = nullptr;
+  return tmp;
+}
+
+template <typename Key, typename T>
+typename map<Key, T>::const_iterator map<Key, T>::cbegin() const {
+  return begin();
+}
+
+template <typename Key, typename T>
+typename map<Key, T>::const_iterator map<Key, T>::cend() const {
+  return end();
+}
+
 // Проверяет, пуст ли контейнер
 template <typename Key, typename T>
 bool map<Key, T>::empty() {
@@ -275,47 +311,28 @@ typename map<Key, T>::size_type map<Key, T>::max_size() {
   return std::numeric_limits<intmax_t>::max() / (10 * sizeof(Key));
 }
 
-// Очищает содержимое
+// Очищает содержимое за один обратный (post-order) обход: каждый узел
+// удаляется, как только удалены его потомки, подъём идёт по parent_
 template <typename Key, typename T>
 void map<Key, T>::clear() {
-  while (head_) {
-    if (head_->right_) {
-      Node *del = head_->right_;
-      while (del->right_ || del->left_) {
-        if (del->right_) {
-          del = del->right_;
-        } else {
-          del = del->left_;
-        }
-      }
-      Node *tmp = del->parent_;
-      if (tmp->right_ == del) {
-        tmp->right_ = nullptr;
-      } else {
-        tmp->left_ = nullptr;
-      }
-      delete del;
-    } else if (head_->left_) {
-      Node *del = head_->left_;
-      while (del->right_ || del->left_) {
-        if (del->right_) {
-          del = del->right_;
-        } else {
-          del = del->left_;
-        }
-      }
-      Node *tmp = del->parent_;
-      if (tmp->right_ == del) {
-        tmp->right_ = nullptr;
-      } else {
-        tmp->left_ = nullptr;
+  Node *del = head_;
+  while (del) {
+    if (del->left_) {
+      del = del->left_;
+    } else if (del->right_) {
+      del = del->right_;
+    } else {
+      Node *parent = del->parent_;
+      if (parent && parent->left_ == del) {
+        parent->left_ = nullptr;
+      } else if (parent) {
+        parent->right_ = nullptr;
       }
       delete del;
-    } else {
-      delete head_;
-      head_ = nullptr;
+      del = parent;
     }
   }
+  head_ = nullptr;
   size_ = 0;
 }
 
@@ -344,12 +361,12 @@ std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert(
   iterator result = begin();
 
   while (1) {
-    if (tmp->key_ == key) {
+    if (tmp->data_.first == key) {
       result.itr_ = tmp;
       break;
     }
 
-    if (tmp->key_ > key) {
+    if (tmp->data_.first > key) {
       if (tmp->left_) {
         tmp = tmp->left_;
       } else {
@@ -384,8 +401,8 @@ std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert_or_assign(
     const Key &key, const T &obj) {
   if (contains(key)) {
     for (iterator tmp = begin(); tmp != end(); ++tmp) {
-      if (tmp.itr_->key_ == key) {
-        tmp.itr_->value_ = obj;
+      if (tmp.itr_->data_.first == key) {
+        tmp.itr_->data_.second = obj;
         return std::pair(tmp, false);
       }
     }
@@ -393,63 +410,28 @@ std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert_or_assign(
   return insert(key, obj);
 }
 
-// Cтирает элемент в позиции
+// Cтирает элемент в позиции. Узел с двумя потомками заменяется своим
+// преемником перестановкой указателей, ключ при этом не копируется
 template <typename Key, typename T>
 void map<Key, T>::erase(typename map<Key, T>::iterator pos) {
-  if (size_ == 1) {
-    delete pos.itr_;
-    head_ = nullptr;
-    size_--;
-    return;
-  }
-
-  Node *tmp = pos.itr_;
-
-  if (tmp->left_ && !tmp->right_ && tmp->parent_) {
-    tmp = tmp->parent_;
-    if (tmp->left_ && tmp->left_ == pos.itr_)
-      tmp->left_ = pos.itr_->left_;
-    else
-      tmp->right_ = pos.itr_->left_;
-    tmp = pos.itr_->left_;
-    tmp->parent_ = pos.itr_->parent_;
-
-  } else if (tmp->right_ && !tmp->left_ && tmp->parent_) {
-    tmp = tmp->parent_;
-    if (tmp->left_ && tmp->left_ == pos.itr_)
-      tmp->left_ = pos.itr_->right_;
-    else
-      tmp->right_ = pos.itr_->right_;
-    tmp = pos.itr_->right_;
-    tmp->parent_ = pos.itr_->parent_;
-
-  } else if (tmp->right_ && tmp->left_) {
-    tmp = tmp->right_;
-    while (tmp->left_) tmp = tmp->left_;
-    pos.itr_->key_ = tmp->key_;
-    pos.itr_->value_ = tmp->value_;
-    pos.itr_ = pos.itr_->right_;
-    while (pos.itr_->left_) pos.itr_ = pos.itr_->left_;
-    erase(pos);
-    return;
-
-  } else if (!tmp->left_ && !tmp->right_) {
-    tmp = tmp->parent_;
-    if (tmp->right_ == pos.itr_)
-      tmp->right_ = nullptr;
-    else
-      tmp->left_ = nullptr;
-
-  } else if (!tmp->left_ && !tmp->parent_) {
-    head_ = pos.itr_->right_;
-    head_->parent_ = nullptr;
-  } else if (!tmp->right_ && !tmp->parent_) {
-    head_ = pos.itr_->left_;
-    head_->parent_ = nullptr;
+  Node *del = pos.itr_;
+  if (del->left_ && del->right_) {
+    Node *next = del->right_;
+    while (next->left_) next = next->left_;
+    if (next != del->right_) {
+      next->parent_->left_ = next->right_;
+      if (next->right_) next->right_->parent_ = next->parent_;
+      next->right_ = del->right_;
+      del->right_->parent_ = next;
+    }
+    next->left_ = del->left_;
+    del->left_->parent_ = next;
+    replace_node(del, next);
+  } else {
+    replace_node(del, del->left_ ? del->left_ : del->right_);
   }
   size_--;
-  delete pos.itr_;
-  pos.itr_ = nullptr;
+  delete del;
 }
 
 // Меняет содержимое
@@ -475,7 +457,7 @@ void map<Key, T>::merge(map &other) {
     itr_other = other.begin();
     for (int i = 0; i < flag; i++, ++itr_other) {
     }
-    ok = insert(itr_other.itr_->key_, itr_other.itr_->value_);
+    ok = insert(itr_other->first, itr_other->second);
     if (!ok.second) {
       flag++;
     } else {
@@ -489,10 +471,10 @@ void map<Key, T>::merge(map &other) {
 template <typename Key, typename T>
 bool map<Key, T>::contains(const Key &key) {
   Node *tmp = head_;
-  while (tmp->key_ != key) {
-    if (tmp->left_ && tmp->key_ > key)
+  while (tmp->data_.first != key) {
+    if (tmp->left_ && tmp->data_.first > key)
       tmp = tmp->left_;
-    else if (tmp->right_ && tmp->key_ < key)
+    else if (tmp->right_ && tmp->data_.first < key)
       tmp = tmp->right_;
     else
       return false;
@@ -500,24 +482,78 @@ bool map<Key, T>::contains(const Key &key) {
   return true;
 }
 
+// Находит элемент с ключом, эквивалентным key, или возвращает end()
+template <typename Key, typename T>
+typename map<Key, T>::iterator map<Key, T>::find(const Key &key) {
+  Node *tmp = head_;
+  while (tmp && tmp->data_.first != key) {
+    tmp = key < tmp->data_.first ? tmp->left_ : tmp->right_;
+  }
+  if (!tmp) return end();
+  iterator result;
+  result.itr_ = tmp;
+  result.itrhead_ = head_;
+  return result;
+}
+
 template <typename Key, typename T>
 template <class... Args>
-std::vector<std::pair<typename map<Key, T>::iterator, bool>>
+small_vector<std::pair<typename map<Key, T>::iterator, bool>>
 map<Key, T>::emplace(Args &&...args) {
-  std::vector<value_type> tmp = {args...};
-  std::vector<std::pair<typename map<Key, T>::iterator, bool>> res(tmp.size());
+  small_vector<value_type> tmp{args...};
+  small_vector<std::pair<iterator, bool>> res;
+  res.reserve(tmp.size());
   for (size_t i = 0; i < tmp.size(); i++) {
-    res[i] = insert(tmp[i]);
+    res.push_back(insert(tmp[i]));
   }
   return res;
 }
 
+// Копирует дерево с корнем cp, сохраняя его форму: узлы создаются в
+// прямом обходе без сравнения ключей и без рекурсии
+template <typename Key, typename T>
+void map<Key, T>::copy(const typename map<Key, T>::Node *cp) {
+  if (!cp) return;
+  head_ = new Node(cp->data_.first, cp->data_.second);
+  size_ = 1;
+  try {
+    Node *dst = head_;
+    while (cp) {
+      if (cp->left_ && !dst->left_) {
+        cp = cp->left_;
+        dst->left_ = new Node(cp->data_.first, cp->data_.second);
+        dst->left_->parent_ = dst;
+        dst = dst->left_;
+        size_++;
+      } else if (cp->right_ && !dst->right_) {
+        cp = cp->right_;
+        dst->right_ = new Node(cp->data_.first, cp->data_.second);
+        dst->right_->parent_ = dst;
+        dst = dst->right_;
+        size_++;
+      } else if (dst == head_) {
+        cp = nullptr;
+      } else {
+        cp = cp->parent_;
+        dst = dst->parent_;
+      }
+    }
+  } catch (...) {
+    clear();
+    throw;
+  }
+}
+
+// Подвешивает child на место node у родителя node
 template <typename Key, typename T>
-void map<Key, T>::copy(typename map<Key, T>::Node *cp) {
-  if (cp) {
-    insert(cp->key_, cp->value_);
-    copy(cp->left_);
-    copy(cp->right_);
+void map<Key, T>::replace_node(Node *node, Node *child) {
+  if (child) child->parent_ = node->parent_;
+  if (!node->parent_) {
+    head_ = child;
+  } else if (node->parent_->left_ == node) {
+    node->parent_->left_ = child;
+  } else {
+    node->parent_->right_ = child;
   }
 }
 
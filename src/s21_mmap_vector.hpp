@@ -0,0 +1,425 @@
+#ifndef SRC_S21_MMAP_VECTOR_HPP_
+#define SRC_S21_MMAP_VECTOR_HPP_
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.hpp"
+
+namespace s21 {
+
+enum class mmap_mode {
+  // Чтение и запись; файла нет - он создаётся. Пишет один процесс
+  read_write,
+  // Только чтение: сколько угодно процессов могут держать файл открытым
+  // одновременно, пока его никто не открыл на запись
+  read_only,
+};
+
+// Вектор тривиально копируемых элементов, который лежит в файле: память
+// вектора - общее отображение файла, поэтому изменения попадают в файл
+// без сериализации, а повторное открытие только отображает его, сколько
+// бы данных там ни было. Рост удлиняет файл. Файл начинается заголовком
+// с размером вектора, вместимость - всё, что за ним. flush() дожидается
+// записи на диск; без него данные попадут туда, когда решит система.
+// Запись и чтение разделяются блокировкой flock: писатель открывает
+// файл исключительно, читатели - совместно. Страницы читателя отображены
+// только на чтение, поэтому в режиме read_only неконстантный доступ к
+// элементам (data, operator[], at, front, back, begin, end) бросает
+// std::logic_error; читать нужно через const-ссылку или cbegin/cend
+template <typename T, class Growth = growth_double>
+class mmap_vector {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "mmap_vector stores raw bytes of its elements");
+  static_assert(alignof(T) <= 64, "mmap_vector aligns elements to 64 bytes");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using iterator = typename vector<T>::iterator;
+  using const_iterator = typename vector<T>::const_iterator;
+
+  explicit mmap_vector(const std::string &path,
+                       mmap_mode mode = mmap_mode::read_write);
+  mmap_vector(const mmap_vector &) = delete;
+  mmap_vector(mmap_vector &&v) noexcept { take(v); }
+  ~mmap_vector() { close(); }
+  mmap_vector &operator=(const mmap_vector &) = delete;
+  mmap_vector &operator=(mmap_vector &&v) noexcept;
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  T &operator[](size_type pos) { return data()[pos]; }
+  const T &operator[](size_type pos) const { return data()[pos]; }
+  reference front() { return data()[0]; }
+  const_reference front() const { return data()[0]; }
+  reference back() { return data()[size_ - 1]; }
+  const_reference back() const { return data()[size_ - 1]; }
+  T *data() {
+    if (read_only()) throw std::logic_error("mmap_vector: read-only");
+    return reinterpret_cast<T *>(base_ + kHeader);
+  }
+  const T *data() const {
+    return reinterpret_cast<const T *>(base_ + kHeader);
+  }
+
+  iterator begin() { return iterator(data()); }
+  iterator end() { return iterator(data() + size_); }
+  const_iterator begin() const { return const_iterator(data()); }
+  const_iterator end() const { return const_iterator(data() + size_); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type max_size() const;
+  size_type capacity() const { return capacity_; }
+  bool read_only() const { return mode_ == mmap_mode::read_only; }
+  const std::string &path() const { return path_; }
+  void reserve(size_type size);
+  // Укорачивает файл до размера вектора
+  void shrink_to_fit();
+  // Сбрасывает изменённые страницы в файл: wait = false только ставит
+  // их в очередь на запись (MS_ASYNC)
+  void flush(bool wait = true);
+
+  void clear() { set_size(0); }
+  void assign(size_type count, const_reference value);
+  template <class InputIt,
+            std::enable_if_t<!std::is_integral<InputIt>::value, int> = 0>
+  void assign(InputIt first, InputIt last);
+  void assign(std::initializer_list<value_type> items);
+  iterator insert(const_iterator pos, const_reference value);
+  template <class InputIt,
+            std::enable_if_t<!std::is_integral<InputIt>::value, int> = 0>
+  iterator insert(const_iterator pos, InputIt first, InputIt last);
+  iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+  iterator erase(const_iterator first, const_iterator last);
+  void push_back(const_reference value);
+  void pop_back();
+  void resize(size_type count, const_reference value = T());
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
+  void swap(mmap_vector &other) noexcept;
+
+ private:
+  // Заголовок файла; данные начинаются с kHeader
+  struct header {
+    uint64_t magic;
+    uint64_t element_size;
+    uint64_t size;
+  };
+  static constexpr size_type kHeader = 64;
+  static constexpr uint64_t kMagic = 0x52544345564d3132;  // "21MVECTR"
+
+  std::string path_;
+  mmap_mode mode_{mmap_mode::read_only};
+  int fd_{-1};
+  char *base_{nullptr};
+  // Длина отображения и файла в байтах
+  size_type length_{0};
+  size_type size_{0};
+  size_type capacity_{0};
+
+  header *head() { return reinterpret_cast<header *>(base_); }
+  // Размер меняется и в объекте, и в заголовке файла
+  void set_size(size_type n);
+  void check_writable() const;
+  // Удлиняет или укорачивает файл и отображение до n элементов
+  void remap(size_type n);
+  void close();
+  void take(mmap_vector &v);
+  [[noreturn]] void fail(const char *what);
+};
+
+template <typename T, class Growth>
+mmap_vector<T, Growth>::mmap_vector(const std::string &path, mmap_mode mode)
+    : path_(path), mode_(mode) {
+  bool writable = mode == mmap_mode::read_write;
+  try {
+    fd_ = ::open(path.c_str(), writable ? O_RDWR | O_CREAT : O_RDONLY, 0644);
+    if (fd_ < 0) fail("open");
+    if (flock(fd_, (writable ? LOCK_EX : LOCK_SH) | LOCK_NB) != 0) {
+      fail("flock");
+    }
+    struct stat st;
+    if (fstat(fd_, &st) != 0) fail("fstat");
+    size_type length = static_cast<size_type>(st.st_size);
+    bool fresh = length == 0 && writable;
+    if (fresh) {
+      length = kHeader;
+      if (ftruncate(fd_, length) != 0) fail("ftruncate");
+    }
+    if (length < kHeader) {
+      throw std::runtime_error("mmap_vector: not a vector file: " + path);
+    }
+    int prot = writable ? PROT_READ | PROT_WRITE : PROT_READ;
+    void *p = mmap(nullptr, length, prot, MAP_SHARED, fd_, 0);
+    if (p == MAP_FAILED) fail("mmap");
+    base_ = static_cast<char *>(p);
+    length_ = length;
+    capacity_ = (length_ - kHeader) / sizeof(T);
+    if (fresh) *head() = header{kMagic, sizeof(T), 0};
+    if (head()->magic != kMagic || head()->element_size != sizeof(T) ||
+        head()->size > capacity_) {
+      throw std::runtime_error("mmap_vector: not a vector file: " + path);
+    }
+    size_ = head()->size;
+  } catch (...) {
+    close();
+    throw;
+  }
+}
+
+template <typename T, class Growth>
+mmap_vector<T, Growth> &mmap_vector<T, Growth>::operator=(
+    mmap_vector &&v) noexcept {
+  if (this != &v) {
+    close();
+    take(v);
+  }
+  return *this;
+}
+
+template <typename T, class Growth>
+typename mmap_vector<T, Growth>::reference mmap_vector<T, Growth>::at(
+    size_type pos) {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return data()[pos];
+}
+
+template <typename T, class Growth>
+typename mmap_vector<T, Growth>::const_reference mmap_vector<T, Growth>::at(
+    size_type pos) const {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return data()[pos];
+}
+
+template <typename T, class Growth>
+typename mmap_vector<T, Growth>::size_type mmap_vector<T, Growth>::max_size()
+    const {
+  return (std::numeric_limits<off_t>::max() - kHeader) / sizeof(T);
+}
+
+template <typename T, class Growth>
+void mmap_vector<T, Growth>::reserve(size_type size) {
+  if (size <= capacity_) return;
+  if (size > max_size()) throw std::length_error("mmap_vector::reserve");
+  check_writable();
+  remap(size);
+}
+
+template <typename T, class Growth>
+void mmap_vector<T, Growth>::shrink_to_fit() {
+  if (size_ == capacity_) return;
+  check_writable();
+  remap(size_);
+}
+
+template <typename T, class Growth>
+void mmap_vector<T, Growth>::flush(bool wait) {
+  if (!base_ || read_only()) return;
+  if (msync(base_, length_, wait ? MS_SYNC : MS_ASYNC) != 0) fail("msync");
+}
+
+// Заменяет содержимое; файл укорачивается только shrink_to_fit
+template <typename T, class Growth>
+void mmap_vector<T, Growth>::assign(size_type count, const_reference value) {
+  T fill = value;
+  clear();
+  resize(count, fill);
+}
+
+template <typename T, class Growth>
+template <class InputIt,
+          std::enable_if_t<!std::is_integral<InputIt>::value, int>>
+void mmap_vector<T, Growth>::assign(InputIt first, InputIt last) {
+  clear();
+  insert(cend(), first, last);
+}
+
+template <typename T, class Growth>
+void mmap_vector<T, Growth>::assign(std::initializer_list<value_type> items) {
+  assign(items.begin(), items.end());
+}
+
+template <typename T, class Growth>
+typename mmap_vector<T, Growth>::iterator mmap_vector<T, Growth>::insert(
+    const_iterator pos, const_reference value) {
+  size_type idx = pos.array_ - data();
+  T copy = value;
+  emplace_back(copy);
+  std::memmove(data() + idx + 1, data() + idx, (size_ - 1 - idx) * sizeof(T));
+  data()[idx] = copy;
+  return iterator(data() + idx);
+}
+
+// Диапазон дописывается в конец и поворотом ставится на место
+template <typename T, class Growth>
+template <class InputIt,
+          std::enable_if_t<!std::is_integral<InputIt>::value, int>>
+typename mmap_vector<T, Growth>::iterator mmap_vector<T, Growth>::insert(
+    const_iterator pos, InputIt first, InputIt last) {
+  size_type idx = pos.array_ - data();
+  size_type old_size = size_;
+  if constexpr (is_forward_iterator<InputIt>::value) {
+    size_type n = static_cast<size_type>(std::distance(first, last));
+    if (size_ + n > capacity_) {
+      reserve(std::max(size_ + n, Growth::next(capacity_)));
+    }
+  }
+  for (; first != last; ++first) emplace_back(*first);
+  std::rotate(data() + idx, data() + old_size, data() + size_);
+  return iterator(data() + idx);
+}
+
+template <typename T, class Growth>
+typename mmap_vector<T, Growth>::iterator mmap_vector<T, Growth>::erase(
+    const_iterator first, const_iterator last) {
+  size_type from = first.array_ - data();
+  size_type to = last.array_ - data();
+  if (from != to) {
+    check_writable();
+    std::memmove(data() + from, data() + to, (size_ - to) * sizeof(T));
+    set_size(size_ - (to - from));
+  }
+  return iterator(data() + from);
+}
+
+template <typename T, class Growth>
+void mmap_vector<T, Growth>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, class Growth>
+void mmap_vector<T, Growth>::pop_back() {
+  if (size_) set_size(size_ - 1);
+}
+
+template <typename T, class Growth>
+void mmap_vector<T, Growth>::resize(size_type count, const_reference value) {
+  T fill = value;
+  if (count > capacity_) reserve(count);
+  for (size_type i = size_; i < count; i++) data()[i] = fill;
+  set_size(count);
+}
+
+// Элемент строится до роста: аргументы могут ссылаться на сам вектор
+template <typename T, class Growth>
+template <typename... Args>
+typename mmap_vector<T, Growth>::reference
+mmap_vector<T, Growth>::emplace_back(Args &&...args) {
+  check_writable();
+  if (size_ == capacity_) {
+    T value(std::forward<Args>(args)...);
+    if (size_ == max_size()) throw std::length_error("mmap_vector");
+    size_type grown = Growth::next(capacity_);
+    remap(grown > max_size() ? max_size() : grown);
+    data()[size_] = value;
+  } else {
+    new (data() + size_) T(std::forward<Args>(args)...);
+  }
+  set_size(size_ + 1);
+  return data()[size_ - 1];
+}
+
+template <typename T, class Growth>
+void mmap_vector<T, Growth>::swap(mmap_vector &other) noexcept {
+  std::swap(path_, other.path_);
+  std::swap(mode_, other.mode_);
+  std::swap(fd_, other.fd_);
+  std::swap(base_, other.base_);
+  std::swap(length_, other.length_);
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+}
+
+template <typename T, class Growth>
+void mmap_vector<T, Growth>::set_size(size_type n) {
+  check_writable();
+  size_ = n;
+  head()->size = n;
+}
+
+template <typename T, class Growth>
+void mmap_vector<T, Growth>::check_writable() const {
+  if (!base_) throw std::logic_error("mmap_vector: no file");
+  if (read_only()) throw std::logic_error("mmap_vector: read-only");
+}
+
+// Файл меняет длину раньше отображения: страницы за концом файла
+// недоступны. Linux переносит отображение mremap без копирования
+template <typename T, class Growth>
+void mmap_vector<T, Growth>::remap(size_type n) {
+  size_type length = kHeader + n * sizeof(T);
+  size_type old_length = length_;
+  if (length > old_length && ftruncate(fd_, length) != 0) fail("ftruncate");
+#if defined(__linux__)
+  void *p = mremap(base_, old_length, length, MREMAP_MAYMOVE);
+  if (p == MAP_FAILED) fail("mremap");
+#else
+  void *p =
+      mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+  if (p == MAP_FAILED) fail("mmap");
+  munmap(base_, old_length);
+#endif
+  base_ = static_cast<char *>(p);
+  length_ = length;
+  capacity_ = n;
+  if (length < old_length && ftruncate(fd_, length) != 0) fail("ftruncate");
+}
+
+template <typename T, class Growth>
+void mmap_vector<T, Growth>::close() {
+  if (base_) munmap(base_, length_);
+  if (fd_ >= 0) ::close(fd_);
+  base_ = nullptr;
+  fd_ = -1;
+  length_ = size_ = capacity_ = 0;
+}
+
+template <typename T, class Growth>
+void mmap_vector<T, Growth>::take(mmap_vector &v) {
+  path_ = std::move(v.path_);
+  mode_ = v.mode_;
+  fd_ = std::exchange(v.fd_, -1);
+  base_ = std::exchange(v.base_, nullptr);
+  length_ = std::exchange(v.length_, 0);
+  size_ = std::exchange(v.size_, 0);
+  capacity_ = std::exchange(v.capacity_, 0);
+}
+
+template <typename T, class Growth>
+void mmap_vector<T, Growth>::fail(const char *what) {
+  int error = errno;
+  throw std::system_error(error, std::generic_category(),
+                          std::string("mmap_vector: ") + what + " " + path_);
+}
+
+}  // namespace s21
+
+#endif  // defined(__unix__) || defined(__APPLE__)
+
+#endif  // SRC_S21_MMAP_VECTOR_HPP_
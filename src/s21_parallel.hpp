@@ -0,0 +1,242 @@
+#ifndef SRC_S21_PARALLEL_HPP_
+#define SRC_S21_PARALLEL_HPP_
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+#include "s21_thread_pool.hpp"
+#include "s21_vector.hpp"
+
+namespace s21 {
+
+// Параллельные алгоритмы над диапазонами с произвольным доступом и над
+// s21::vector. Диапазон режется на куски по grain элементов; куски
+// раздаёт thread_pool, соседние куски обычно достаются одному потоку.
+// grain = 0 выбирает размер сам: около восьми кусков на поток, но не
+// меньше kMinGrain элементов
+namespace parallel {
+
+constexpr size_t kMinGrain = 1024;
+
+namespace detail {
+
+inline size_t grain_for(const thread_pool &pool, size_t n, size_t grain) {
+  if (grain) return grain;
+  size_t chunk = n / (pool.size() * 8);
+  return chunk < kMinGrain ? kMinGrain : chunk;
+}
+
+inline size_t chunks_for(size_t n, size_t grain) {
+  return (n + grain - 1) / grain;
+}
+
+// Число элементов из [a, a + na), которые попадают в первые k элементов
+// слияния с [b, b + nb). При равенстве раньше идут элементы a, поэтому
+// слияние устойчиво
+template <class It, class Compare>
+size_t co_rank(size_t k, It a, size_t na, It b, size_t nb, Compare &comp) {
+  size_t lo = k > nb ? k - nb : 0;
+  size_t hi = k < na ? k : na;
+  while (lo < hi) {
+    size_t i = lo + (hi - lo) / 2;
+    if (comp(b[k - i - 1], a[i])) {
+      hi = i;
+    } else {
+      lo = i + 1;
+    }
+  }
+  return lo;
+}
+
+// Сливает соседние отсортированные куски длины width из src в dst. Выход
+// делится на части по grain элементов, границы частей в исходных кусках
+// находятся двоичным поиском, поэтому даже последнее слияние двух
+// половин идёт на всех потоках
+template <class It, class Out, class Compare>
+void merge_pass(thread_pool &pool, It src, Out dst, size_t n, size_t width,
+                size_t grain, Compare &comp) {
+  size_t pieces = chunks_for(n, grain);
+  pool.parallel_for(pieces, [&](size_t p) {
+    size_t out_begin = p * grain;
+    size_t out_end = std::min(n, out_begin + grain);
+    size_t pair = out_begin / (2 * width) * (2 * width);
+    size_t mid = std::min(n, pair + width);
+    size_t last = std::min(n, pair + 2 * width);
+    // Часть не пересекает границу пары: grain делит 2 * width
+    It a = src + pair;
+    It b = src + mid;
+    size_t na = mid - pair;
+    size_t nb = last - mid;
+    size_t k0 = out_begin - pair;
+    size_t k1 = out_end - pair;
+    size_t i0 = co_rank(k0, a, na, b, nb, comp);
+    size_t i1 = co_rank(k1, a, na, b, nb, comp);
+    std::merge(std::make_move_iterator(a + i0),
+               std::make_move_iterator(a + i1),
+               std::make_move_iterator(b + (k0 - i0)),
+               std::make_move_iterator(b + (k1 - i1)), dst + out_begin, comp);
+  });
+}
+
+}  // namespace detail
+
+// Вызывает f(x) для каждого элемента
+template <class It, class F>
+void for_each(thread_pool &pool, It first, It last, F f, size_t grain = 0) {
+  size_t n = static_cast<size_t>(last - first);
+  grain = detail::grain_for(pool, n, grain);
+  pool.parallel_for(detail::chunks_for(n, grain), [&](size_t c) {
+    It begin = first + c * grain;
+    It end = first + std::min(n, (c + 1) * grain);
+    for (; begin != end; ++begin) f(*begin);
+  });
+}
+
+// Записывает f(x) в out для каждого элемента, возвращает конец записанного
+template <class It, class Out, class F>
+Out transform(thread_pool &pool, It first, It last, Out out, F f,
+              size_t grain = 0) {
+  size_t n = static_cast<size_t>(last - first);
+  grain = detail::grain_for(pool, n, grain);
+  pool.parallel_for(detail::chunks_for(n, grain), [&](size_t c) {
+    size_t begin = c * grain;
+    size_t end = std::min(n, begin + grain);
+    std::transform(first + begin, first + end, out + begin, f);
+  });
+  return out + n;
+}
+
+// Свёртка op по кускам и затем по их итогам в порядке кусков: op должна
+// быть ассоциативной, коммутативность не требуется
+template <class It, class T, class Op = std::plus<>>
+T reduce(thread_pool &pool, It first, It last, T init, Op op = Op(),
+         size_t grain = 0) {
+  size_t n = static_cast<size_t>(last - first);
+  if (n == 0) return init;
+  grain = detail::grain_for(pool, n, grain);
+  size_t chunks = detail::chunks_for(n, grain);
+  vector<T> partial(chunks);
+  pool.parallel_for(chunks, [&](size_t c) {
+    It begin = first + c * grain;
+    It end = first + std::min(n, (c + 1) * grain);
+    T acc = *begin;
+    for (++begin; begin != end; ++begin) acc = op(std::move(acc), *begin);
+    partial[c] = std::move(acc);
+  });
+  for (size_t c = 0; c < chunks; c++) init = op(std::move(init), partial[c]);
+  return init;
+}
+
+// out[i] = x[0] op ... op x[i]. Три прохода: итоги кусков параллельно,
+// префиксы итогов последовательно, затем каждый кусок сканируется со
+// своим начальным значением. out может совпадать с first
+template <class It, class Out, class Op = std::plus<>>
+Out inclusive_scan(thread_pool &pool, It first, It last, Out out,
+                   Op op = Op(), size_t grain = 0) {
+  using T = typename std::iterator_traits<It>::value_type;
+  size_t n = static_cast<size_t>(last - first);
+  if (n == 0) return out;
+  grain = detail::grain_for(pool, n, grain);
+  size_t chunks = detail::chunks_for(n, grain);
+  vector<T> carry(chunks);
+  pool.parallel_for(chunks, [&](size_t c) {
+    It begin = first + c * grain;
+    It end = first + std::min(n, (c + 1) * grain);
+    T acc = *begin;
+    for (++begin; begin != end; ++begin) acc = op(std::move(acc), *begin);
+    carry[c] = std::move(acc);
+  });
+  for (size_t c = 1; c < chunks; c++) {
+    carry[c] = op(carry[c - 1], std::move(carry[c]));
+  }
+  pool.parallel_for(chunks, [&](size_t c) {
+    size_t i = c * grain;
+    size_t end = std::min(n, i + grain);
+    T acc = c ? op(carry[c - 1], first[i]) : T(first[i]);
+    out[i] = acc;
+    for (i++; i < end; i++) {
+      acc = op(std::move(acc), first[i]);
+      out[i] = acc;
+    }
+  });
+  return out + n;
+}
+
+// Сортировка слиянием: куски по grain элементов сортируются параллельно,
+// затем сливаются попарно, перекладываясь между диапазоном и буфером.
+// Устойчива, если устойчива сортировка кусков, поэтому внутри кусков
+// используется std::stable_sort
+template <class It, class Compare = std::less<>>
+void sort(thread_pool &pool, It first, It last, Compare comp = Compare(),
+          size_t grain = 0) {
+  using T = typename std::iterator_traits<It>::value_type;
+  size_t n = static_cast<size_t>(last - first);
+  if (n < 2) return;
+  grain = detail::grain_for(pool, n, grain);
+  size_t chunks = detail::chunks_for(n, grain);
+  pool.parallel_for(chunks, [&](size_t c) {
+    std::stable_sort(first + c * grain, first + std::min(n, (c + 1) * grain),
+                     comp);
+  });
+  if (chunks == 1) return;
+  vector<T> buffer(n);
+  bool in_buffer = false;
+  for (size_t width = grain; width < n; width *= 2) {
+    if (in_buffer) {
+      detail::merge_pass(pool, buffer.begin(), first, n, width, grain, comp);
+    } else {
+      detail::merge_pass(pool, first, buffer.begin(), n, width, grain, comp);
+    }
+    in_buffer = !in_buffer;
+  }
+  if (in_buffer) {
+    pool.parallel_for(chunks, [&](size_t c) {
+      size_t begin = c * grain;
+      size_t end = std::min(n, begin + grain);
+      std::move(buffer.begin() + begin, buffer.begin() + end, first + begin);
+    });
+  }
+}
+
+template <class T, class G, class F>
+void for_each(thread_pool &pool, vector<T, G> &v, F f, size_t grain = 0) {
+  parallel::for_each(pool, v.begin(), v.end(), std::move(f), grain);
+}
+
+// Результат пишется в out, размер out подгоняется под v
+template <class T, class G, class U, class H, class F>
+void transform(thread_pool &pool, const vector<T, G> &v, vector<U, H> &out,
+               F f, size_t grain = 0) {
+  out.resize(v.size());
+  parallel::transform(pool, v.begin(), v.end(), out.begin(), std::move(f),
+                      grain);
+}
+
+template <class T, class G, class U, class Op = std::plus<>>
+U reduce(thread_pool &pool, const vector<T, G> &v, U init, Op op = Op(),
+         size_t grain = 0) {
+  return parallel::reduce(pool, v.begin(), v.end(), std::move(init),
+                          std::move(op), grain);
+}
+
+// Сканирует v на месте
+template <class T, class G, class Op = std::plus<>>
+void inclusive_scan(thread_pool &pool, vector<T, G> &v, Op op = Op(),
+                    size_t grain = 0) {
+  parallel::inclusive_scan(pool, v.begin(), v.end(), v.begin(),
+                           std::move(op), grain);
+}
+
+template <class T, class G, class Compare = std::less<>>
+void sort(thread_pool &pool, vector<T, G> &v, Compare comp = Compare(),
+          size_t grain = 0) {
+  parallel::sort(pool, v.begin(), v.end(), std::move(comp), grain);
+}
+
+}  // namespace parallel
+
+}  // namespace s21
+
+#endif  // SRC_S21_PARALLEL_HPP_
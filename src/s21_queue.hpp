@@ -50,7 +50,7 @@ class queue {
 
   template <class... Args>
   void emplace_back(Args &&...args) {
-    list.emplace_back(args...);
+    list.insert_many_back(std::forward<Args>(args)...);
   }
 };
 }  // namespace s21
@@ -0,0 +1,1147 @@
+#ifndef SRC_S21_RADIX_MAP_HPP_
+#define SRC_S21_RADIX_MAP_HPP_
+
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace s21 {
+
+// Побайтовое представление ключа. Порядок байтов выбран так, чтобы
+// лексикографическое сравнение байтов совпадало со сравнением ключей.
+// Для своих типов ключей достаточно написать специализацию с size и at
+template <class Key, class Enable = void>
+struct radix_key;
+
+// Целые числа: big-endian, у знаковых инвертирован знаковый бит
+template <class Key>
+struct radix_key<Key, std::enable_if_t<std::is_integral<Key>::value &&
+                                       !std::is_same<Key, bool>::value>> {
+  using unsigned_type = std::make_unsigned_t<Key>;
+  static size_t size(const Key &) { return sizeof(Key); }
+  static unsigned char at(const Key &key, size_t i) {
+    unsigned_type bits = static_cast<unsigned_type>(key);
+    if (std::is_signed<Key>::value) {
+      bits ^= static_cast<unsigned_type>(unsigned_type(1)
+                                         << (sizeof(Key) * 8 - 1));
+    }
+    return static_cast<unsigned char>(bits >> ((sizeof(Key) - 1 - i) * 8));
+  }
+};
+
+// Строки: байты как есть, более короткая строка идёт раньше своих
+// продолжений
+template <>
+struct radix_key<std::string> {
+  static size_t size(const std::string &key) { return key.size(); }
+  static unsigned char at(const std::string &key, size_t i) {
+    return static_cast<unsigned char>(key[i]);
+  }
+};
+
+// Adaptive radix tree: внутренние узлы на 4/16/48/256 потомков, сжатие
+// путей (до kMaxPrefix байт префикса хранится в узле, остальное проверяется
+// по ключу в листе). Листья связаны в двусвязный список в порядке ключей,
+// поэтому обход и выборка по префиксу не требуют спуска по дереву
+template <class Key, class T, class KeyBytes = radix_key<Key>>
+class radix_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+
+ private:
+  enum node_type : unsigned char { kLeaf, kNode4, kNode16, kNode48, kNode256 };
+  static constexpr size_t kMaxPrefix = 8;
+
+  struct radix_node {
+    node_type type_;
+    explicit radix_node(node_type type) : type_(type) {}
+  };
+
+  struct radix_leaf : radix_node {
+    value_type data_;
+    radix_leaf *prev_{nullptr};
+    radix_leaf *next_{nullptr};
+    radix_leaf(const Key &key, const T &value)
+        : radix_node(kLeaf), data_(key, value) {}
+  };
+
+  // leaf_ - лист, ключ которого заканчивается ровно на этом узле
+  struct radix_inner : radix_node {
+    unsigned short count_{0};
+    unsigned prefix_len_{0};
+    unsigned char prefix_[kMaxPrefix] = {};
+    radix_leaf *leaf_{nullptr};
+    explicit radix_inner(node_type type) : radix_node(type) {}
+  };
+
+  struct radix_node4 : radix_inner {
+    unsigned char keys_[4] = {};
+    radix_node *children_[4] = {};
+    radix_node4() : radix_inner(kNode4) {}
+  };
+
+  struct radix_node16 : radix_inner {
+    unsigned char keys_[16] = {};
+    radix_node *children_[16] = {};
+    radix_node16() : radix_inner(kNode16) {}
+  };
+
+  // index_[byte] - номер слота в children_ плюс один, 0 - потомка нет
+  struct radix_node48 : radix_inner {
+    unsigned char index_[256] = {};
+    radix_node *children_[48] = {};
+    radix_node48() : radix_inner(kNode48) {}
+  };
+
+  struct radix_node256 : radix_inner {
+    radix_node *children_[256] = {};
+    radix_node256() : radix_inner(kNode256) {}
+  };
+
+ public:
+  class RadixIterator {
+   public:
+    radix_leaf *itr_;
+    const radix_map *map_;
+
+    RadixIterator() : itr_(nullptr), map_(nullptr) {}
+    RadixIterator(radix_leaf *leaf, const radix_map *one)
+        : itr_(leaf), map_(one) {}
+
+    RadixIterator operator++() {
+      itr_ = itr_->next_;
+      return *this;
+    }
+    RadixIterator operator--() {
+      itr_ = itr_ ? itr_->prev_ : map_->tail_;
+      return *this;
+    }
+
+    bool operator!=(const RadixIterator &it) { return itr_ != it.itr_; }
+    bool operator==(const RadixIterator &it) { return itr_ == it.itr_; }
+
+    reference operator*() const { return itr_->data_; }
+    value_type *operator->() const { return &itr_->data_; }
+  };
+  using iterator = typename radix_map::RadixIterator;
+
+  class RadixConstIterator {
+   public:
+    radix_map::iterator citr;
+
+    RadixConstIterator() {}
+    explicit RadixConstIterator(const RadixIterator &other) : citr(other) {}
+
+    RadixConstIterator operator++() {
+      ++citr;
+      return *this;
+    }
+    RadixConstIterator operator--() {
+      --citr;
+      return *this;
+    }
+
+    bool operator!=(const RadixConstIterator &it) { return citr != it.citr; }
+    bool operator==(const RadixConstIterator &it) { return citr == it.citr; }
+
+    const_reference operator*() const { return *citr; }
+    const value_type *operator->() const { return &*citr; }
+  };
+  using const_iterator = typename radix_map::RadixConstIterator;
+
+  radix_map() {}
+  explicit radix_map(std::initializer_list<value_type> const &items);
+  radix_map(const radix_map &m);
+  radix_map(radix_map &&m);
+  ~radix_map() { clear(); }
+  radix_map &operator=(const radix_map &m);
+  radix_map &operator=(radix_map &&m);
+
+  T &at(const Key &key);
+  T &operator[](const Key &key);
+
+  iterator begin() { return iterator(head_, this); }
+  iterator end() { return iterator(nullptr, this); }
+  const_iterator begin() const {
+    return const_iterator(iterator(head_, this));
+  }
+  const_iterator end() const { return const_iterator(iterator(nullptr, this)); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type max_size() const;
+  // Объём памяти, занятый узлами и листьями дерева, в байтах
+  size_type memory_usage() const { return node_memory(root_); }
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(const Key &key, const T &obj);
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj);
+  void erase(iterator pos);
+  void swap(radix_map &other);
+  void merge(radix_map &other);
+
+  iterator find(const Key &key) { return iterator(find_leaf(key), this); }
+  bool contains(const Key &key) const { return find_leaf(key) != nullptr; }
+  // Диапазон [first, last) всех ключей, начинающихся с байтов prefix
+  std::pair<iterator, iterator> prefix_range(const Key &prefix);
+
+ private:
+  struct insert_result {
+    radix_leaf *leaf{nullptr};
+    radix_leaf *prev{nullptr};
+    bool inserted{false};
+    bool prev_found{false};
+  };
+
+  radix_node *root_{nullptr};
+  radix_leaf *head_{nullptr};
+  radix_leaf *tail_{nullptr};
+  size_type size_{0};
+
+  radix_leaf *find_leaf(const Key &key) const;
+  void insert_node(radix_node *&ref, const Key &key, const T &obj,
+                   size_t depth, insert_result &res);
+  void split_prefix(radix_node *&ref, radix_inner *node, const Key &key,
+                    const T &obj, size_t depth, size_t mismatch,
+                    insert_result &res);
+  void erase_node(radix_node *&ref, radix_leaf *leaf, size_t depth);
+  void link_leaf(radix_leaf *leaf, radix_leaf *prev);
+
+  static size_t prefix_mismatch(radix_inner *node, const Key &key,
+                                size_t depth);
+  static void find_prev(radix_inner *node, unsigned char byte,
+                        insert_result &res);
+  static radix_node **find_child(radix_inner *node, unsigned char byte);
+  static void add_child(radix_node *&ref, radix_inner *node,
+                        unsigned char byte, radix_node *child);
+  static void remove_child(radix_node *&ref, radix_inner *node,
+                           unsigned char byte);
+  static void collapse(radix_node *&ref);
+  static radix_node *prev_child(radix_inner *node, unsigned char byte);
+  static radix_node *first_child(radix_inner *node);
+  static radix_node *last_child(radix_inner *node);
+  static radix_leaf *min_leaf(radix_node *node);
+  static radix_leaf *max_leaf(radix_node *node);
+  static void copy_header(radix_inner *dst, const radix_inner *src);
+  static void delete_node(radix_node *node);
+  static void destroy(radix_node *node);
+  static size_type node_memory(radix_node *node);
+
+  template <class Node>
+  static void insert_sorted(Node *node, unsigned char byte, radix_node *child);
+  template <class Node>
+  static void remove_sorted(Node *node, unsigned char byte);
+  template <class F>
+  static void for_each_child(radix_inner *node, F &&f);
+};
+
+// Конструктор списка инициализаторов
+template <class Key, class T, class KeyBytes>
+radix_map<Key, T, KeyBytes>::radix_map(
+    std::initializer_list<value_type> const &items) {
+  for (const auto &element : items) {
+    insert(element);
+  }
+}
+
+// Конструктор копирования: листья вставляются в порядке ключей
+template <class Key, class T, class KeyBytes>
+radix_map<Key, T, KeyBytes>::radix_map(const radix_map &m) {
+  for (radix_leaf *leaf = m.head_; leaf; leaf = leaf->next_) {
+    insert(leaf->data_.first, leaf->data_.second);
+  }
+}
+
+// Конструктор перемещения
+template <class Key, class T, class KeyBytes>
+radix_map<Key, T, KeyBytes>::radix_map(radix_map &&m) {
+  swap(m);
+}
+
+// Перегрузка оператора присваивания копированием
+template <class Key, class T, class KeyBytes>
+radix_map<Key, T, KeyBytes> &radix_map<Key, T, KeyBytes>::operator=(
+    const radix_map &m) {
+  if (this != &m) {
+    radix_map tmp(m);
+    swap(tmp);
+  }
+  return *this;
+}
+
+// Перегрузка оператора присваивания для движущегося объекта
+template <class Key, class T, class KeyBytes>
+radix_map<Key, T, KeyBytes> &radix_map<Key, T, KeyBytes>::operator=(
+    radix_map &&m) {
+  if (this != &m) {
+    clear();
+    swap(m);
+  }
+  return *this;
+}
+
+// Доступ к указанному элементу с проверкой наличия ключа
+template <class Key, class T, class KeyBytes>
+T &radix_map<Key, T, KeyBytes>::at(const Key &key) {
+  radix_leaf *leaf = find_leaf(key);
+  if (!leaf) {
+    throw std::out_of_range("The key does not exist, out of the radix_map!");
+  }
+  return leaf->data_.second;
+}
+
+// Получить доступ или вставить элемент со значением по умолчанию
+template <class Key, class T, class KeyBytes>
+T &radix_map<Key, T, KeyBytes>::operator[](const Key &key) {
+  radix_leaf *leaf = find_leaf(key);
+  if (leaf) return leaf->data_.second;
+  return insert(key, T()).first->second;
+}
+
+// Возвращает максимально возможное количество элементов
+template <class Key, class T, class KeyBytes>
+typename radix_map<Key, T, KeyBytes>::size_type
+radix_map<Key, T, KeyBytes>::max_size() const {
+  return std::numeric_limits<size_type>::max() /
+         (sizeof(radix_leaf) + sizeof(radix_node4));
+}
+
+// Очищает содержимое
+template <class Key, class T, class KeyBytes>
+void radix_map<Key, T, KeyBytes>::clear() {
+  destroy(root_);
+  root_ = nullptr;
+  head_ = nullptr;
+  tail_ = nullptr;
+  size_ = 0;
+}
+
+template <class Key, class T, class KeyBytes>
+std::pair<typename radix_map<Key, T, KeyBytes>::iterator, bool>
+radix_map<Key, T, KeyBytes>::insert(const value_type &value) {
+  return insert(value.first, value.second);
+}
+
+// Вставляет значение по ключу. Соседний меньший лист находится по пути
+// обратно к корню, поэтому новый лист встаёт в список за O(1)
+template <class Key, class T, class KeyBytes>
+std::pair<typename radix_map<Key, T, KeyBytes>::iterator, bool>
+radix_map<Key, T, KeyBytes>::insert(const Key &key, const T &obj) {
+  insert_result res;
+  insert_node(root_, key, obj, 0, res);
+  if (res.inserted) {
+    link_leaf(res.leaf, res.prev);
+    ++size_;
+  }
+  return std::pair(iterator(res.leaf, this), res.inserted);
+}
+
+// Вставляет элемент или присваивает значение существующему
+template <class Key, class T, class KeyBytes>
+std::pair<typename radix_map<Key, T, KeyBytes>::iterator, bool>
+radix_map<Key, T, KeyBytes>::insert_or_assign(const Key &key, const T &obj) {
+  auto res = insert(key, obj);
+  if (!res.second) res.first->second = obj;
+  return res;
+}
+
+// Стирает элемент в позиции
+template <class Key, class T, class KeyBytes>
+void radix_map<Key, T, KeyBytes>::erase(iterator pos) {
+  radix_leaf *leaf = pos.itr_;
+  erase_node(root_, leaf, 0);
+  if (leaf->prev_) {
+    leaf->prev_->next_ = leaf->next_;
+  } else {
+    head_ = leaf->next_;
+  }
+  if (leaf->next_) {
+    leaf->next_->prev_ = leaf->prev_;
+  } else {
+    tail_ = leaf->prev_;
+  }
+  delete leaf;
+  --size_;
+}
+
+// Меняет содержимое
+template <class Key, class T, class KeyBytes>
+void radix_map<Key, T, KeyBytes>::swap(radix_map &other) {
+  std::swap(root_, other.root_);
+  std::swap(head_, other.head_);
+  std::swap(tail_, other.tail_);
+  std::swap(size_, other.size_);
+}
+
+// Переносит из other элементы, ключей которых ещё нет в контейнере
+template <class Key, class T, class KeyBytes>
+void radix_map<Key, T, KeyBytes>::merge(radix_map &other) {
+  for (iterator it = other.begin(); it != other.end();) {
+    iterator cur = it;
+    ++it;
+    if (insert(cur->first, cur->second).second) other.erase(cur);
+  }
+}
+
+// Все ключи поддерева, в котором закончился prefix, идут в списке листьев
+// подряд: от минимального листа поддерева до следующего за максимальным
+template <class Key, class T, class KeyBytes>
+std::pair<typename radix_map<Key, T, KeyBytes>::iterator,
+          typename radix_map<Key, T, KeyBytes>::iterator>
+radix_map<Key, T, KeyBytes>::prefix_range(const Key &prefix) {
+  const size_t len = KeyBytes::size(prefix);
+  radix_node *node = root_;
+  size_t depth = 0;
+  while (node && node->type_ != kLeaf && depth < len) {
+    auto *inner = static_cast<radix_inner *>(node);
+    size_t stored = std::min<size_t>(inner->prefix_len_, kMaxPrefix);
+    for (size_t i = 0; i < stored && depth + i < len; i++) {
+      if (inner->prefix_[i] != KeyBytes::at(prefix, depth + i)) {
+        return std::pair(end(), end());
+      }
+    }
+    depth += inner->prefix_len_;
+    if (depth >= len) break;
+    radix_node **child = find_child(inner, KeyBytes::at(prefix, depth));
+    node = child ? *child : nullptr;
+    ++depth;
+  }
+  if (!node) return std::pair(end(), end());
+  // Байты префикса, пропущенные при сжатии пути, сверяются по ключу листа
+  radix_leaf *first = min_leaf(node);
+  const Key &first_key = first->data_.first;
+  if (KeyBytes::size(first_key) < len) return std::pair(end(), end());
+  for (size_t i = 0; i < len; i++) {
+    if (KeyBytes::at(first_key, i) != KeyBytes::at(prefix, i)) {
+      return std::pair(end(), end());
+    }
+  }
+  return std::pair(iterator(first, this),
+                   iterator(max_leaf(node)->next_, this));
+}
+
+// Поиск листа: префиксы узлов сравниваются только в сохранённой части,
+// окончательная проверка - сравнение ключа в листе
+template <class Key, class T, class KeyBytes>
+typename radix_map<Key, T, KeyBytes>::radix_leaf *
+radix_map<Key, T, KeyBytes>::find_leaf(const Key &key) const {
+  const size_t len = KeyBytes::size(key);
+  radix_node *node = root_;
+  size_t depth = 0;
+  while (node && node->type_ != kLeaf) {
+    auto *inner = static_cast<radix_inner *>(node);
+    if (inner->prefix_len_) {
+      if (depth + inner->prefix_len_ > len) return nullptr;
+      size_t stored = std::min<size_t>(inner->prefix_len_, kMaxPrefix);
+      for (size_t i = 0; i < stored; i++) {
+        if (inner->prefix_[i] != KeyBytes::at(key, depth + i)) return nullptr;
+      }
+      depth += inner->prefix_len_;
+    }
+    if (depth == len) {
+      node = inner->leaf_;
+      break;
+    }
+    radix_node **child = find_child(inner, KeyBytes::at(key, depth));
+    node = child ? *child : nullptr;
+    ++depth;
+  }
+  auto *leaf = static_cast<radix_leaf *>(node);
+  if (leaf && leaf->data_.first == key) return leaf;
+  return nullptr;
+}
+
+template <class Key, class T, class KeyBytes>
+void radix_map<Key, T, KeyBytes>::insert_node(radix_node *&ref,
+                                              const Key &key, const T &obj,
+                                              size_t depth,
+                                              insert_result &res) {
+  if (!ref) {
+    res.leaf = new radix_leaf(key, obj);
+    res.inserted = true;
+    ref = res.leaf;
+    return;
+  }
+
+  // Лист с другим ключом заменяется узлом на общем префиксе двух ключей
+  if (ref->type_ == kLeaf) {
+    auto *old = static_cast<radix_leaf *>(ref);
+    const Key &old_key = old->data_.first;
+    if (old_key == key) {
+      res.leaf = old;
+      return;
+    }
+    const size_t len = KeyBytes::size(key);
+    const size_t old_len = KeyBytes::size(old_key);
+    size_t split = depth;
+    while (split < len && split < old_len &&
+           KeyBytes::at(key, split) == KeyBytes::at(old_key, split)) {
+      ++split;
+    }
+    auto *node = new radix_node4;
+    try {
+      res.leaf = new radix_leaf(key, obj);
+    } catch (...) {
+      delete node;
+      throw;
+    }
+    node->prefix_len_ = static_cast<unsigned>(split - depth);
+    for (size_t i = 0; i < node->prefix_len_ && i < kMaxPrefix; i++) {
+      node->prefix_[i] = KeyBytes::at(key, depth + i);
+    }
+    bool old_first;
+    if (split == old_len) {
+      node->leaf_ = old;
+      insert_sorted(node, KeyBytes::at(key, split), res.leaf);
+      old_first = true;
+    } else if (split == len) {
+      node->leaf_ = res.leaf;
+      insert_sorted(node, KeyBytes::at(old_key, split), old);
+      old_first = false;
+    } else {
+      insert_sorted(node, KeyBytes::at(old_key, split), old);
+      insert_sorted(node, KeyBytes::at(key, split), res.leaf);
+      old_first = KeyBytes::at(old_key, split) < KeyBytes::at(key, split);
+    }
+    ref = node;
+    res.inserted = true;
+    if (old_first) {
+      res.prev = old;
+      res.prev_found = true;
+    }
+    return;
+  }
+
+  auto *node = static_cast<radix_inner *>(ref);
+  if (node->prefix_len_) {
+    size_t mismatch = prefix_mismatch(node, key, depth);
+    if (mismatch < node->prefix_len_) {
+      split_prefix(ref, node, key, obj, depth, mismatch, res);
+      return;
+    }
+    depth += node->prefix_len_;
+  }
+
+  // Ключ закончился на узле: лист узла меньше всех его потомков, поэтому
+  // предыдущий лист ищется выше по пути
+  if (depth == KeyBytes::size(key)) {
+    if (!node->leaf_) {
+      node->leaf_ = new radix_leaf(key, obj);
+      res.inserted = true;
+    }
+    res.leaf = node->leaf_;
+    return;
+  }
+
+  unsigned char byte = KeyBytes::at(key, depth);
+  radix_node **child = find_child(node, byte);
+  if (child) {
+    insert_node(*child, key, obj, depth + 1, res);
+    if (res.inserted) find_prev(node, byte, res);
+  } else {
+    find_prev(node, byte, res);
+    auto *leaf = new radix_leaf(key, obj);
+    try {
+      add_child(ref, node, byte, leaf);
+    } catch (...) {
+      delete leaf;
+      throw;
+    }
+    res.leaf = leaf;
+    res.inserted = true;
+  }
+}
+
+// Ключ разошёлся с префиксом узла на позиции mismatch: над узлом ставится
+// новый Node4 с общей частью префикса
+template <class Key, class T, class KeyBytes>
+void radix_map<Key, T, KeyBytes>::split_prefix(radix_node *&ref,
+                                               radix_inner *node,
+                                               const Key &key, const T &obj,
+                                               size_t depth, size_t mismatch,
+                                               insert_result &res) {
+  auto *parent = new radix_node4;
+  try {
+    res.leaf = new radix_leaf(key, obj);
+  } catch (...) {
+    delete parent;
+    throw;
+  }
+  parent->prefix_len_ = static_cast<unsigned>(mismatch);
+  std::memcpy(parent->prefix_, node->prefix_,
+              std::min<size_t>(mismatch, kMaxPrefix));
+
+  unsigned char old_byte;
+  if (node->prefix_len_ <= kMaxPrefix) {
+    old_byte = node->prefix_[mismatch];
+    node->prefix_len_ -= static_cast<unsigned>(mismatch + 1);
+    std::memmove(node->prefix_, node->prefix_ + mismatch + 1,
+                 node->prefix_len_);
+  } else {
+    const Key &min_key = min_leaf(node)->data_.first;
+    old_byte = KeyBytes::at(min_key, depth + mismatch);
+    node->prefix_len_ -= static_cast<unsigned>(mismatch + 1);
+    for (size_t i = 0; i < node->prefix_len_ && i < kMaxPrefix; i++) {
+      node->prefix_[i] = KeyBytes::at(min_key, depth + mismatch + 1 + i);
+    }
+  }
+  insert_sorted(parent, old_byte, node);
+
+  const size_t split = depth + mismatch;
+  bool key_ends = KeyBytes::size(key) == split;
+  if (key_ends) {
+    parent->leaf_ = res.leaf;
+  } else {
+    insert_sorted(parent, KeyBytes::at(key, split), res.leaf);
+  }
+  ref = parent;
+  res.inserted = true;
+  if (!key_ends && old_byte < KeyBytes::at(key, split)) {
+    res.prev = max_leaf(node);
+    res.prev_found = true;
+  }
+}
+
+template <class Key, class T, class KeyBytes>
+void radix_map<Key, T, KeyBytes>::erase_node(radix_node *&ref,
+                                             radix_leaf *leaf, size_t depth) {
+  if (ref == leaf) {
+    ref = nullptr;
+    return;
+  }
+  auto *node = static_cast<radix_inner *>(ref);
+  const Key &key = leaf->data_.first;
+  depth += node->prefix_len_;
+  if (depth == KeyBytes::size(key)) {
+    node->leaf_ = nullptr;
+  } else {
+    unsigned char byte = KeyBytes::at(key, depth);
+    radix_node **child = find_child(node, byte);
+    if (*child != leaf) {
+      erase_node(*child, leaf, depth + 1);
+      return;
+    }
+    remove_child(ref, node, byte);
+  }
+  collapse(ref);
+}
+
+// Вставляет лист в список листьев сразу после prev (в начало, если prev нет)
+template <class Key, class T, class KeyBytes>
+void radix_map<Key, T, KeyBytes>::link_leaf(radix_leaf *leaf,
+                                            radix_leaf *prev) {
+  radix_leaf *next = prev ? prev->next_ : head_;
+  leaf->prev_ = prev;
+  leaf->next_ = next;
+  if (prev) {
+    prev->next_ = leaf;
+  } else {
+    head_ = leaf;
+  }
+  if (next) {
+    next->prev_ = leaf;
+  } else {
+    tail_ = leaf;
+  }
+}
+
+// Позиция первого расхождения ключа с префиксом узла. Байты префикса сверх
+// kMaxPrefix берутся из ключа минимального листа поддерева
+template <class Key, class T, class KeyBytes>
+size_t radix_map<Key, T, KeyBytes>::prefix_mismatch(radix_inner *node,
+                                                    const Key &key,
+                                                    size_t depth) {
+  const size_t len = KeyBytes::size(key);
+  const size_t stored = std::min<size_t>(node->prefix_len_, kMaxPrefix);
+  size_t i = 0;
+  for (; i < stored; i++) {
+    if (depth + i >= len || node->prefix_[i] != KeyBytes::at(key, depth + i)) {
+      return i;
+    }
+  }
+  if (node->prefix_len_ > kMaxPrefix) {
+    const Key &min_key = min_leaf(node)->data_.first;
+    for (; i < node->prefix_len_; i++) {
+      if (depth + i >= len ||
+          KeyBytes::at(min_key, depth + i) != KeyBytes::at(key, depth + i)) {
+        return i;
+      }
+    }
+  }
+  return i;
+}
+
+// Ищет в узле лист, предшествующий вставляемому по байту byte
+template <class Key, class T, class KeyBytes>
+void radix_map<Key, T, KeyBytes>::find_prev(radix_inner *node,
+                                            unsigned char byte,
+                                            insert_result &res) {
+  if (res.prev_found) return;
+  radix_node *prev = prev_child(node, byte);
+  if (prev) {
+    res.prev = max_leaf(prev);
+    res.prev_found = true;
+  } else if (node->leaf_) {
+    res.prev = node->leaf_;
+    res.prev_found = true;
+  }
+}
+
+// В Node16 байт ищется одним сравнением 16 ключей через SSE2
+template <class Key, class T, class KeyBytes>
+typename radix_map<Key, T, KeyBytes>::radix_node **
+radix_map<Key, T, KeyBytes>::find_child(radix_inner *node,
+                                        unsigned char byte) {
+  switch (node->type_) {
+    case kNode4: {
+      auto *n = static_cast<radix_node4 *>(node);
+      for (unsigned i = 0; i < n->count_; i++) {
+        if (n->keys_[i] == byte) return &n->children_[i];
+      }
+      return nullptr;
+    }
+    case kNode16: {
+      auto *n = static_cast<radix_node16 *>(node);
+#if defined(__SSE2__)
+      __m128i cmp = _mm_cmpeq_epi8(
+          _mm_set1_epi8(static_cast<char>(byte)),
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(n->keys_)));
+      unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(cmp)) &
+                      ((1u << n->count_) - 1);
+      return mask ? &n->children_[__builtin_ctz(mask)] : nullptr;
+#else
+      for (unsigned i = 0; i < n->count_; i++) {
+        if (n->keys_[i] == byte) return &n->children_[i];
+      }
+      return nullptr;
+#endif
+    }
+    case kNode48: {
+      auto *n = static_cast<radix_node48 *>(node);
+      return n->index_[byte] ? &n->children_[n->index_[byte] - 1] : nullptr;
+    }
+    default: {
+      auto *n = static_cast<radix_node256 *>(node);
+      return n->children_[byte] ? &n->children_[byte] : nullptr;
+    }
+  }
+}
+
+// Добавляет потомка, при переполнении узел заменяется следующим по размеру
+template <class Key, class T, class KeyBytes>
+void radix_map<Key, T, KeyBytes>::add_child(radix_node *&ref,
+                                            radix_inner *node,
+                                            unsigned char byte,
+                                            radix_node *child) {
+  switch (node->type_) {
+    case kNode4: {
+      auto *n = static_cast<radix_node4 *>(node);
+      if (n->count_ < 4) {
+        insert_sorted(n, byte, child);
+        return;
+      }
+      auto *grown = new radix_node16;
+      copy_header(grown, n);
+      std::memcpy(grown->keys_, n->keys_, sizeof(n->keys_));
+      std::memcpy(grown->children_, n->children_, sizeof(n->children_));
+      insert_sorted(grown, byte, child);
+      ref = grown;
+      delete n;
+      return;
+    }
+    case kNode16: {
+      auto *n = static_cast<radix_node16 *>(node);
+      if (n->count_ < 16) {
+        insert_sorted(n, byte, child);
+        return;
+      }
+      auto *grown = new radix_node48;
+      copy_header(grown, n);
+      for (unsigned i = 0; i < 16; i++) {
+        grown->children_[i] = n->children_[i];
+        grown->index_[n->keys_[i]] = static_cast<unsigned char>(i + 1);
+      }
+      grown->children_[16] = child;
+      grown->index_[byte] = 17;
+      ++grown->count_;
+      ref = grown;
+      delete n;
+      return;
+    }
+    case kNode48: {
+      auto *n = static_cast<radix_node48 *>(node);
+      if (n->count_ < 48) {
+        unsigned slot = 0;
+        while (n->children_[slot]) ++slot;
+        n->children_[slot] = child;
+        n->index_[byte] = static_cast<unsigned char>(slot + 1);
+        ++n->count_;
+        return;
+      }
+      auto *grown = new radix_node256;
+      copy_header(grown, n);
+      for (unsigned b = 0; b < 256; b++) {
+        if (n->index_[b]) grown->children_[b] = n->children_[n->index_[b] - 1];
+      }
+      grown->children_[byte] = child;
+      ++grown->count_;
+      ref = grown;
+      delete n;
+      return;
+    }
+    default: {
+      auto *n = static_cast<radix_node256 *>(node);
+      n->children_[byte] = child;
+      ++n->count_;
+      return;
+    }
+  }
+}
+
+// Удаляет потомка, недозаполненный узел заменяется меньшим. Пороги ниже
+// порогов роста, чтобы узел не пересоздавался на чередовании вставок и
+// удалений
+template <class Key, class T, class KeyBytes>
+void radix_map<Key, T, KeyBytes>::remove_child(radix_node *&ref,
+                                               radix_inner *node,
+                                               unsigned char byte) {
+  switch (node->type_) {
+    case kNode4:
+      remove_sorted(static_cast<radix_node4 *>(node), byte);
+      return;
+    case kNode16: {
+      auto *n = static_cast<radix_node16 *>(node);
+      remove_sorted(n, byte);
+      if (n->count_ > 3) return;
+      auto *shrunk = new radix_node4;
+      copy_header(shrunk, n);
+      std::memcpy(shrunk->keys_, n->keys_, n->count_);
+      std::memcpy(shrunk->children_, n->children_,
+                  n->count_ * sizeof(radix_node *));
+      ref = shrunk;
+      delete n;
+      return;
+    }
+    case kNode48: {
+      auto *n = static_cast<radix_node48 *>(node);
+      n->children_[n->index_[byte] - 1] = nullptr;
+      n->index_[byte] = 0;
+      --n->count_;
+      if (n->count_ > 12) return;
+      auto *shrunk = new radix_node16;
+      copy_header(shrunk, n);
+      unsigned pos = 0;
+      for (unsigned b = 0; b < 256; b++) {
+        if (!n->index_[b]) continue;
+        shrunk->keys_[pos] = static_cast<unsigned char>(b);
+        shrunk->children_[pos++] = n->children_[n->index_[b] - 1];
+      }
+      ref = shrunk;
+      delete n;
+      return;
+    }
+    default: {
+      auto *n = static_cast<radix_node256 *>(node);
+      n->children_[byte] = nullptr;
+      --n->count_;
+      if (n->count_ > 37) return;
+      auto *shrunk = new radix_node48;
+      copy_header(shrunk, n);
+      unsigned slot = 0;
+      for (unsigned b = 0; b < 256; b++) {
+        if (!n->children_[b]) continue;
+        shrunk->children_[slot] = n->children_[b];
+        shrunk->index_[b] = static_cast<unsigned char>(++slot);
+      }
+      ref = shrunk;
+      delete n;
+      return;
+    }
+  }
+}
+
+// Node4 без потомков заменяется своим листом, Node4 с единственным
+// потомком сливается с ним: префиксы склеиваются через байт потомка
+template <class Key, class T, class KeyBytes>
+void radix_map<Key, T, KeyBytes>::collapse(radix_node *&ref) {
+  if (ref->type_ != kNode4) return;
+  auto *node = static_cast<radix_node4 *>(ref);
+  if (node->count_ == 0) {
+    ref = node->leaf_;
+    delete node;
+  } else if (node->count_ == 1 && !node->leaf_) {
+    radix_node *child = node->children_[0];
+    if (child->type_ != kLeaf) {
+      auto *inner = static_cast<radix_inner *>(child);
+      unsigned char prefix[kMaxPrefix];
+      size_t len = std::min<size_t>(node->prefix_len_, kMaxPrefix);
+      std::memcpy(prefix, node->prefix_, len);
+      if (len < kMaxPrefix) prefix[len++] = node->keys_[0];
+      for (size_t i = 0; len < kMaxPrefix && i < inner->prefix_len_; i++) {
+        prefix[len++] = inner->prefix_[i];
+      }
+      inner->prefix_len_ += node->prefix_len_ + 1;
+      std::memcpy(inner->prefix_, prefix, len);
+    }
+    ref = child;
+    delete node;
+  }
+}
+
+// Наибольший потомок с байтом меньше byte
+template <class Key, class T, class KeyBytes>
+typename radix_map<Key, T, KeyBytes>::radix_node *
+radix_map<Key, T, KeyBytes>::prev_child(radix_inner *node,
+                                        unsigned char byte) {
+  switch (node->type_) {
+    case kNode4: {
+      auto *n = static_cast<radix_node4 *>(node);
+      for (unsigned i = n->count_; i-- > 0;) {
+        if (n->keys_[i] < byte) return n->children_[i];
+      }
+      return nullptr;
+    }
+    case kNode16: {
+      auto *n = static_cast<radix_node16 *>(node);
+      for (unsigned i = n->count_; i-- > 0;) {
+        if (n->keys_[i] < byte) return n->children_[i];
+      }
+      return nullptr;
+    }
+    case kNode48: {
+      auto *n = static_cast<radix_node48 *>(node);
+      for (unsigned b = byte; b-- > 0;) {
+        if (n->index_[b]) return n->children_[n->index_[b] - 1];
+      }
+      return nullptr;
+    }
+    default: {
+      auto *n = static_cast<radix_node256 *>(node);
+      for (unsigned b = byte; b-- > 0;) {
+        if (n->children_[b]) return n->children_[b];
+      }
+      return nullptr;
+    }
+  }
+}
+
+template <class Key, class T, class KeyBytes>
+typename radix_map<Key, T, KeyBytes>::radix_node *
+radix_map<Key, T, KeyBytes>::first_child(radix_inner *node) {
+  switch (node->type_) {
+    case kNode4:
+      return static_cast<radix_node4 *>(node)->children_[0];
+    case kNode16:
+      return static_cast<radix_node16 *>(node)->children_[0];
+    case kNode48: {
+      auto *n = static_cast<radix_node48 *>(node);
+      for (unsigned b = 0; b < 256; b++) {
+        if (n->index_[b]) return n->children_[n->index_[b] - 1];
+      }
+      return nullptr;
+    }
+    default: {
+      auto *n = static_cast<radix_node256 *>(node);
+      for (unsigned b = 0; b < 256; b++) {
+        if (n->children_[b]) return n->children_[b];
+      }
+      return nullptr;
+    }
+  }
+}
+
+template <class Key, class T, class KeyBytes>
+typename radix_map<Key, T, KeyBytes>::radix_node *
+radix_map<Key, T, KeyBytes>::last_child(radix_inner *node) {
+  switch (node->type_) {
+    case kNode4: {
+      auto *n = static_cast<radix_node4 *>(node);
+      return n->children_[n->count_ - 1];
+    }
+    case kNode16: {
+      auto *n = static_cast<radix_node16 *>(node);
+      return n->children_[n->count_ - 1];
+    }
+    case kNode48: {
+      auto *n = static_cast<radix_node48 *>(node);
+      for (unsigned b = 256; b-- > 0;) {
+        if (n->index_[b]) return n->children_[n->index_[b] - 1];
+      }
+      return nullptr;
+    }
+    default: {
+      auto *n = static_cast<radix_node256 *>(node);
+      for (unsigned b = 256; b-- > 0;) {
+        if (n->children_[b]) return n->children_[b];
+      }
+      return nullptr;
+    }
+  }
+}
+
+// Минимальный лист поддерева: лист узла меньше всех его потомков
+template <class Key, class T, class KeyBytes>
+typename radix_map<Key, T, KeyBytes>::radix_leaf *
+radix_map<Key, T, KeyBytes>::min_leaf(radix_node *node) {
+  while (node->type_ != kLeaf) {
+    auto *inner = static_cast<radix_inner *>(node);
+    if (inner->leaf_) return inner->leaf_;
+    node = first_child(inner);
+  }
+  return static_cast<radix_leaf *>(node);
+}
+
+template <class Key, class T, class KeyBytes>
+typename radix_map<Key, T, KeyBytes>::radix_leaf *
+radix_map<Key, T, KeyBytes>::max_leaf(radix_node *node) {
+  while (node->type_ != kLeaf) {
+    auto *inner = static_cast<radix_inner *>(node);
+    if (!inner->count_) return inner->leaf_;
+    node = last_child(inner);
+  }
+  return static_cast<radix_leaf *>(node);
+}
+
+template <class Key, class T, class KeyBytes>
+void radix_map<Key, T, KeyBytes>::copy_header(radix_inner *dst,
+                                              const radix_inner *src) {
+  dst->count_ = src->count_;
+  dst->prefix_len_ = src->prefix_len_;
+  std::memcpy(dst->prefix_, src->prefix_, kMaxPrefix);
+  dst->leaf_ = src->leaf_;
+}
+
+// Узлы не имеют виртуального деструктора, удаление идёт по типу узла
+template <class Key, class T, class KeyBytes>
+void radix_map<Key, T, KeyBytes>::delete_node(radix_node *node) {
+  switch (node->type_) {
+    case kLeaf:
+      delete static_cast<radix_leaf *>(node);
+      break;
+    case kNode4:
+      delete static_cast<radix_node4 *>(node);
+      break;
+    case kNode16:
+      delete static_cast<radix_node16 *>(node);
+      break;
+    case kNode48:
+      delete static_cast<radix_node48 *>(node);
+      break;
+    default:
+      delete static_cast<radix_node256 *>(node);
+      break;
+  }
+}
+
+template <class Key, class T, class KeyBytes>
+void radix_map<Key, T, KeyBytes>::destroy(radix_node *node) {
+  if (!node) return;
+  if (node->type_ != kLeaf) {
+    auto *inner = static_cast<radix_inner *>(node);
+    for_each_child(inner, [](radix_node *child) { destroy(child); });
+    destroy(inner->leaf_);
+  }
+  delete_node(node);
+}
+
+template <class Key, class T, class KeyBytes>
+typename radix_map<Key, T, KeyBytes>::size_type
+radix_map<Key, T, KeyBytes>::node_memory(radix_node *node) {
+  if (!node) return 0;
+  if (node->type_ == kLeaf) return sizeof(radix_leaf);
+  auto *inner = static_cast<radix_inner *>(node);
+  size_type total = node_memory(inner->leaf_);
+  for_each_child(inner,
+                 [&total](radix_node *child) { total += node_memory(child); });
+  switch (node->type_) {
+    case kNode4:
+      return total + sizeof(radix_node4);
+    case kNode16:
+      return total + sizeof(radix_node16);
+    case kNode48:
+      return total + sizeof(radix_node48);
+    default:
+      return total + sizeof(radix_node256);
+  }
+}
+
+// Ключи Node4 и Node16 хранятся отсортированными
+template <class Key, class T, class KeyBytes>
+template <class Node>
+void radix_map<Key, T, KeyBytes>::insert_sorted(Node *node,
+                                                unsigned char byte,
+                                                radix_node *child) {
+  unsigned pos = 0;
+  while (pos < node->count_ && node->keys_[pos] < byte) ++pos;
+  std::memmove(node->keys_ + pos + 1, node->keys_ + pos, node->count_ - pos);
+  std::memmove(node->children_ + pos + 1, node->children_ + pos,
+               (node->count_ - pos) * sizeof(radix_node *));
+  node->keys_[pos] = byte;
+  node->children_[pos] = child;
+  ++node->count_;
+}
+
+template <class Key, class T, class KeyBytes>
+template <class Node>
+void radix_map<Key, T, KeyBytes>::remove_sorted(Node *node,
+                                                unsigned char byte) {
+  unsigned pos = 0;
+  while (node->keys_[pos] != byte) ++pos;
+  --node->count_;
+  std::memmove(node->keys_ + pos, node->keys_ + pos + 1, node->count_ - pos);
+  std::memmove(node->children_ + pos, node->children_ + pos + 1,
+               (node->count_ - pos) * sizeof(radix_node *));
+  node->children_[node->count_] = nullptr;
+}
+
+template <class Key, class T, class KeyBytes>
+template <class F>
+void radix_map<Key, T, KeyBytes>::for_each_child(radix_inner *node, F &&f) {
+  switch (node->type_) {
+    case kNode4: {
+      auto *n = static_cast<radix_node4 *>(node);
+      for (unsigned i = 0; i < n->count_; i++) f(n->children_[i]);
+      break;
+    }
+    case kNode16: {
+      auto *n = static_cast<radix_node16 *>(node);
+      for (unsigned i = 0; i < n->count_; i++) f(n->children_[i]);
+      break;
+    }
+    case kNode48: {
+      auto *n = static_cast<radix_node48 *>(node);
+      for (unsigned i = 0; i < 48; i++) {
+        if (n->children_[i]) f(n->children_[i]);
+      }
+      break;
+    }
+    default: {
+      auto *n = static_cast<radix_node256 *>(node);
+      for (unsigned b = 0; b < 256; b++) {
+        if (n->children_[b]) f(n->children_[b]);
+      }
+      break;
+    }
+  }
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_RADIX_MAP_HPP_
@@ -4,6 +4,7 @@
 #include <initializer_list>
 
 #include "s21_btree.hpp"
+#include "s21_small_vector.hpp"
 #include "s21_vector.hpp"
 
 namespace s21 {
@@ -75,9 +76,10 @@ class set {
 
   //  *** Emplace
   template <class... Args>
-  vector<std::pair<iterator, bool>> emplace(Args &&...args) {
-    vector<value_type> tmp = vector<value_type>{args...};
-    vector<std::pair<iterator, bool>> ret;
+  small_vector<std::pair<iterator, bool>> emplace(Args &&...args) {
+    small_vector<value_type> tmp{args...};
+    small_vector<std::pair<iterator, bool>> ret;
+    ret.reserve(tmp.size());
     for (size_t it = 0; it < tmp.size(); ++it) {
       ret.push_back(this->insert(tmp[it]));
     }
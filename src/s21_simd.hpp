@@ -0,0 +1,639 @@
+#ifndef SRC_S21_SIMD_HPP_
+#define SRC_S21_SIMD_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+namespace s21 {
+namespace simd {
+
+// Набор инструкций, которым пользуются алгоритмы. vector128 - 16-байтные
+// векторы базового набора (SSE2 на x86-64, NEON на AArch64), avx2 -
+// 32-байтные, выбираются при запуске, если процессор их поддерживает
+enum class isa { scalar, vector128, avx2 };
+
+// Лучший набор, доступный на этом процессоре
+inline isa detected_isa() {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  static const isa best = [] {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return isa::avx2;
+#if defined(__SSE2__)
+    return isa::vector128;
+#else
+    return isa::scalar;
+#endif
+  }();
+  return best;
+#elif defined(__GNUC__)
+  return isa::vector128;
+#else
+  return isa::scalar;
+#endif
+}
+
+namespace detail {
+inline isa &active() {
+  static isa level = detected_isa();
+  return level;
+}
+}  // namespace detail
+
+// Набор, которым алгоритмы пользуются сейчас
+inline isa active_isa() { return detail::active(); }
+
+// Ограничивает алгоритмы набором level (для сравнения и тестов); набор
+// выше доступного на процессоре не включается
+inline void set_isa(isa level) {
+  detail::active() = level < detected_isa() ? level : detected_isa();
+}
+
+// Тип суммы: целые складываются в 64 бита по модулю 2^64
+template <class T>
+using sum_type = std::conditional_t<
+    std::is_integral<T>::value && !std::is_same<T, bool>::value,
+    std::conditional_t<std::is_signed<T>::value, int64_t, uint64_t>, T>;
+
+namespace detail {
+
+// Векторизуются арифметические типы размером 1, 2, 4 и 8 байт
+template <class T>
+constexpr bool vectorizable =
+#if defined(__GNUC__)
+    std::is_arithmetic<T>::value && !std::is_same<T, bool>::value &&
+    (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+#else
+    false;
+#endif
+
+// Побитовые операции над словами: dst = dst op src
+enum class bit_op { op_and, op_or, op_xor, op_and_not };
+
+template <bit_op Op, class V>
+inline void apply_bit_op(V &a, const V &b) {
+  if constexpr (Op == bit_op::op_and) a &= b;
+  if constexpr (Op == bit_op::op_or) a |= b;
+  if constexpr (Op == bit_op::op_xor) a ^= b;
+  if constexpr (Op == bit_op::op_and_not) a &= ~b;
+}
+
+#if defined(__GNUC__)
+
+template <class T, size_t W>
+struct vec {
+  typedef T type __attribute__((vector_size(W)));
+};
+
+// Результат сравнения векторов: целые той же ширины, что и T
+template <size_t S>
+struct lane;
+template <>
+struct lane<1> {
+  using type = int8_t;
+};
+template <>
+struct lane<2> {
+  using type = int16_t;
+};
+template <>
+struct lane<4> {
+  using type = int32_t;
+};
+template <>
+struct lane<8> {
+  using type = int64_t;
+};
+
+template <class T, size_t W>
+using vec_t = typename vec<T, W>::type;
+template <class T, size_t W>
+using mask_t = typename vec<typename lane<sizeof(T)>::type, W>::type;
+
+// Векторы передаются по ссылке: передача по значению меняла бы ABI в
+// зависимости от target
+template <class V>
+[[gnu::always_inline]] inline void load(V &v, const void *p) {
+  std::memcpy(&v, p, sizeof(V));
+}
+
+// Есть ли в маске хотя бы одна истинная дорожка
+template <size_t W, class M>
+[[gnu::always_inline]] inline bool any(const M &m) {
+  vec_t<uint64_t, W> words;
+  load(words, &m);
+  uint64_t acc = 0;
+  for (size_t i = 0; i < W / 8; i++) acc |= words[i];
+  return acc != 0;
+}
+
+// Ядра пишутся один раз на векторных расширениях GCC и встраиваются в
+// обёртки с нужным target: из одного текста получаются SSE2 и AVX2
+template <class T, size_t W>
+[[gnu::always_inline]] inline const T *find_kernel(const T *first,
+                                                   const T *last, T value) {
+  using V = vec_t<T, W>;
+  constexpr ptrdiff_t lanes = W / sizeof(T);
+  V needle = V{} + value;
+  V one, two;
+  for (; last - first >= 2 * lanes; first += 2 * lanes) {
+    load(one, first);
+    load(two, first + lanes);
+    if (any<W>((one == needle) | (two == needle))) break;
+  }
+  for (; first != last; ++first) {
+    if (*first == value) return first;
+  }
+  return last;
+}
+
+template <class T, size_t W>
+[[gnu::always_inline]] inline size_t count_kernel(const T *first,
+                                                  const T *last, T value) {
+  using V = vec_t<T, W>;
+  using M = mask_t<T, W>;
+  constexpr ptrdiff_t lanes = W / sizeof(T);
+  // Счётчики дорожек узкие: их сбрасываем в total до переполнения
+  constexpr size_t flush = sizeof(T) == 1 ? 127 : 32767;
+  V needle = V{} + value, v;
+  size_t total = 0;
+  while (last - first >= lanes) {
+    M acc = {};
+    for (size_t block = 0; block < flush && last - first >= lanes; block++) {
+      load(v, first);
+      acc -= (v == needle);
+      first += lanes;
+    }
+    for (ptrdiff_t i = 0; i < lanes; i++) total += acc[i];
+  }
+  for (; first != last; ++first) total += *first == value;
+  return total;
+}
+
+template <class T, size_t W>
+[[gnu::always_inline]] inline void fill_kernel(T *first, T *last, T value) {
+  using V = vec_t<T, W>;
+  constexpr ptrdiff_t lanes = W / sizeof(T);
+  V pattern = V{} + value;
+  for (; last - first >= lanes; first += lanes) {
+    std::memcpy(first, &pattern, W);
+  }
+  for (; first != last; ++first) *first = value;
+}
+
+template <class T, size_t W>
+[[gnu::always_inline]] inline bool equal_kernel(const T *a, const T *b,
+                                                size_t n) {
+  using V = vec_t<T, W>;
+  constexpr size_t lanes = W / sizeof(T);
+  V one, two;
+  size_t i = 0;
+  for (; i + lanes <= n; i += lanes) {
+    load(one, a + i);
+    load(two, b + i);
+    if (any<W>(one != two)) return false;
+  }
+  for (; i < n; i++) {
+    if (!(a[i] == b[i])) return false;
+  }
+  return true;
+}
+
+// Less задаёт направление: меньший или больший элемент
+template <class T, size_t W, bool Less>
+[[gnu::always_inline]] inline T extremum_kernel(const T *first,
+                                                const T *last) {
+  using V = vec_t<T, W>;
+  constexpr ptrdiff_t lanes = W / sizeof(T);
+  T best = *first;
+  if (last - first >= lanes) {
+    V acc, v;
+    load(acc, first);
+    for (first += lanes; last - first >= lanes; first += lanes) {
+      load(v, first);
+      acc = (Less ? v < acc : acc < v) ? v : acc;
+    }
+    best = acc[0];
+    for (ptrdiff_t i = 1; i < lanes; i++) {
+      if (Less ? acc[i] < best : best < acc[i]) best = acc[i];
+    }
+  }
+  for (; first != last; ++first) {
+    if (Less ? *first < best : best < *first) best = *first;
+  }
+  return best;
+}
+
+// Вещественные складываются в четырёх независимых суммах своего типа.
+// Целые суммируются по модулю 2^64 без расширяющих инструкций: 64-битное
+// слово из 8 / sizeof(T) элементов режется сдвигами на поля, каждое
+// поле копится в своём 64-битном счётчике. Знаковые элементы сдвигаются
+// в беззнаковые инверсией старшего бита, сдвиг вычитается в конце
+template <class T, size_t W>
+[[gnu::always_inline]] inline sum_type<T> sum_kernel(const T *first,
+                                                     const T *last) {
+  constexpr ptrdiff_t lanes = W / sizeof(T);
+  if constexpr (std::is_floating_point<T>::value) {
+    using V = vec_t<T, W>;
+    V acc[4] = {}, v;
+    for (; last - first >= 4 * lanes; first += 4 * lanes) {
+      for (int k = 0; k < 4; k++) {
+        load(v, first + k * lanes);
+        acc[k] += v;
+      }
+    }
+    V all = (acc[0] + acc[1]) + (acc[2] + acc[3]);
+    T total = 0;
+    for (ptrdiff_t i = 0; i < lanes; i++) total += all[i];
+    for (; first != last; ++first) total += *first;
+    return total;
+  } else {
+    using U = vec_t<uint64_t, W>;
+    constexpr unsigned bits = 8 * sizeof(T);
+    constexpr unsigned fields = 8 / sizeof(T);
+    constexpr uint64_t mask = bits == 64 ? ~0ULL : (1ULL << (bits % 64)) - 1;
+    constexpr uint64_t top = std::is_signed<T>::value
+                                 ? ~0ULL / mask * (1ULL << (bits - 1))
+                                 : 0;
+    U acc[fields] = {}, w;
+    uint64_t words = 0;
+    for (; last - first >= lanes; first += lanes, words++) {
+      load(w, first);
+      w ^= top;
+      for (unsigned k = 0; k < fields; k++) {
+        acc[k] += (w >> (k * bits)) & mask;
+      }
+    }
+    uint64_t total = 0;
+    for (unsigned k = 0; k < fields; k++) {
+      for (size_t i = 0; i < W / 8; i++) total += acc[k][i];
+    }
+    if (top) total -= words * lanes * (1ULL << (bits - 1));
+    for (; first != last; ++first) total += static_cast<uint64_t>(*first);
+    return static_cast<sum_type<T>>(total);
+  }
+}
+
+template <bit_op Op, size_t W>
+[[gnu::always_inline]] inline void bitwise_kernel(uint64_t *dst,
+                                                  const uint64_t *src,
+                                                  size_t n) {
+  using U = vec_t<uint64_t, W>;
+  constexpr size_t lanes = W / 8;
+  U a, b;
+  size_t i = 0;
+  for (; i + lanes <= n; i += lanes) {
+    load(a, dst + i);
+    load(b, src + i);
+    apply_bit_op<Op>(a, b);
+    std::memcpy(dst + i, &a, W);
+  }
+  for (; i < n; i++) apply_bit_op<Op>(dst[i], src[i]);
+}
+
+template <size_t W>
+[[gnu::always_inline]] inline void not_kernel(uint64_t *dst, size_t n) {
+  using U = vec_t<uint64_t, W>;
+  constexpr size_t lanes = W / 8;
+  U a;
+  size_t i = 0;
+  for (; i + lanes <= n; i += lanes) {
+    load(a, dst + i);
+    a = ~a;
+    std::memcpy(dst + i, &a, W);
+  }
+  for (; i < n; i++) dst[i] = ~dst[i];
+}
+
+// Число единиц без инструкции popcnt: каждое слово сворачивается в
+// счётчики байтов (не больше 8 в байте), байты копятся 31 блок - до 248,
+// без переноса в соседний байт, - затем складываются в 64-битные поля
+template <size_t W>
+[[gnu::always_inline]] inline size_t popcount_kernel(const uint64_t *words,
+                                                     size_t n) {
+  using U = vec_t<uint64_t, W>;
+  constexpr size_t lanes = W / 8;
+  const U m1 = U{} + 0x5555555555555555ULL;
+  const U m2 = U{} + 0x3333333333333333ULL;
+  const U m4 = U{} + 0x0f0f0f0f0f0f0f0fULL;
+  const U m8 = U{} + 0x00ff00ff00ff00ffULL;
+  const U m16 = U{} + 0x0000ffff0000ffffULL;
+  const U m32 = U{} + 0x00000000ffffffffULL;
+  size_t total = 0;
+  size_t i = 0;
+  U v, acc;
+  while (i + lanes <= n) {
+    acc = U{};
+    for (int block = 0; block < 31 && i + lanes <= n; block++, i += lanes) {
+      load(v, words + i);
+      v = v - ((v >> 1) & m1);
+      v = (v & m2) + ((v >> 2) & m2);
+      acc += (v + (v >> 4)) & m4;
+    }
+    acc = (acc & m8) + ((acc >> 8) & m8);
+    acc = (acc & m16) + ((acc >> 16) & m16);
+    acc = (acc & m32) + (acc >> 32);
+    for (size_t k = 0; k < lanes; k++) total += acc[k];
+  }
+  for (; i < n; i++) total += __builtin_popcountll(words[i]);
+  return total;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+template <class T>
+[[gnu::target("avx2")]] const T *find_avx2(const T *first, const T *last,
+                                           T value) {
+  return find_kernel<T, 32>(first, last, value);
+}
+
+template <class T>
+[[gnu::target("avx2")]] size_t count_avx2(const T *first, const T *last,
+                                          T value) {
+  return count_kernel<T, 32>(first, last, value);
+}
+
+template <class T>
+[[gnu::target("avx2")]] void fill_avx2(T *first, T *last, T value) {
+  fill_kernel<T, 32>(first, last, value);
+}
+
+template <class T>
+[[gnu::target("avx2")]] bool equal_avx2(const T *a, const T *b, size_t n) {
+  return equal_kernel<T, 32>(a, b, n);
+}
+
+template <class T, bool Less>
+[[gnu::target("avx2")]] T extremum_avx2(const T *first, const T *last) {
+  return extremum_kernel<T, 32, Less>(first, last);
+}
+
+template <class T>
+[[gnu::target("avx2")]] sum_type<T> sum_avx2(const T *first, const T *last) {
+  return sum_kernel<T, 32>(first, last);
+}
+
+template <bit_op Op>
+[[gnu::target("avx2")]] void bitwise_avx2(uint64_t *dst, const uint64_t *src,
+                                          size_t n) {
+  bitwise_kernel<Op, 32>(dst, src, n);
+}
+
+[[gnu::target("avx2")]] inline void not_avx2(uint64_t *dst, size_t n) {
+  not_kernel<32>(dst, n);
+}
+
+// На процессорах с AVX2 есть popcnt: по слову за такт быстрее свёртки
+[[gnu::target("avx2,popcnt")]] inline size_t popcount_avx2(
+    const uint64_t *words, size_t n) {
+  size_t total[4] = {};
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    for (int k = 0; k < 4; k++) total[k] += __builtin_popcountll(words[i + k]);
+  }
+  for (; i < n; i++) total[0] += __builtin_popcountll(words[i]);
+  return total[0] + total[1] + total[2] + total[3];
+}
+#endif
+
+#endif  // __GNUC__
+
+}  // namespace detail
+
+// Первый элемент, равный value, или last
+template <class T>
+const T *find(const T *first, const T *last, const T &value) {
+  if constexpr (detail::vectorizable<T>) {
+#if defined(__x86_64__) || defined(__i386__)
+    if (active_isa() == isa::avx2) {
+      return detail::find_avx2<T>(first, last, value);
+    }
+#endif
+    if (active_isa() != isa::scalar) {
+      return detail::find_kernel<T, 16>(first, last, value);
+    }
+  }
+  for (; first != last; ++first) {
+    if (*first == value) return first;
+  }
+  return last;
+}
+
+template <class T>
+size_t count(const T *first, const T *last, const T &value) {
+  if constexpr (detail::vectorizable<T>) {
+#if defined(__x86_64__) || defined(__i386__)
+    if (active_isa() == isa::avx2) {
+      return detail::count_avx2<T>(first, last, value);
+    }
+#endif
+    if (active_isa() != isa::scalar) {
+      return detail::count_kernel<T, 16>(first, last, value);
+    }
+  }
+  size_t total = 0;
+  for (; first != last; ++first) total += *first == value;
+  return total;
+}
+
+template <class T>
+void fill(T *first, T *last, const T &value) {
+  if constexpr (detail::vectorizable<T>) {
+#if defined(__x86_64__) || defined(__i386__)
+    if (active_isa() == isa::avx2) {
+      detail::fill_avx2<T>(first, last, value);
+      return;
+    }
+#endif
+    if (active_isa() != isa::scalar) {
+      detail::fill_kernel<T, 16>(first, last, value);
+      return;
+    }
+  }
+  for (; first != last; ++first) *first = value;
+}
+
+// Поэлементное равенство n элементов; вещественные сравниваются через ==
+template <class T>
+bool equal(const T *a, const T *b, size_t n) {
+  if constexpr (detail::vectorizable<T>) {
+#if defined(__x86_64__) || defined(__i386__)
+    if (active_isa() == isa::avx2) return detail::equal_avx2<T>(a, b, n);
+#endif
+    if (active_isa() != isa::scalar) {
+      return detail::equal_kernel<T, 16>(a, b, n);
+    }
+  }
+  for (size_t i = 0; i < n; i++) {
+    if (!(a[i] == b[i])) return false;
+  }
+  return true;
+}
+
+namespace detail {
+template <bool Less, class T>
+T extremum(const T *first, const T *last) {
+  if (first == last) throw std::out_of_range("empty range");
+  if constexpr (vectorizable<T>) {
+#if defined(__x86_64__) || defined(__i386__)
+    if (active_isa() == isa::avx2) return extremum_avx2<T, Less>(first, last);
+#endif
+    if (active_isa() != isa::scalar) {
+      return extremum_kernel<T, 16, Less>(first, last);
+    }
+  }
+  T best = *first;
+  for (++first; first != last; ++first) {
+    if (Less ? *first < best : best < *first) best = *first;
+  }
+  return best;
+}
+}  // namespace detail
+
+// Наименьший элемент непустого диапазона. Для вещественных с NaN
+// результат зависит от порядка обхода, как и у std::min_element
+template <class T>
+T min(const T *first, const T *last) {
+  return detail::extremum<true>(first, last);
+}
+
+template <class T>
+T max(const T *first, const T *last) {
+  return detail::extremum<false>(first, last);
+}
+
+// Сумма элементов. Вещественные складываются в другом порядке, чем в
+// последовательном цикле, поэтому результат может отличаться в младших
+// разрядах
+template <class T>
+sum_type<T> sum(const T *first, const T *last) {
+  if constexpr (detail::vectorizable<T>) {
+#if defined(__x86_64__) || defined(__i386__)
+    if (active_isa() == isa::avx2) return detail::sum_avx2<T>(first, last);
+#endif
+    if (active_isa() != isa::scalar) {
+      return detail::sum_kernel<T, 16>(first, last);
+    }
+  }
+  sum_type<T> total{};
+  for (; first != last; ++first) total += *first;
+  return total;
+}
+
+namespace detail {
+template <bit_op Op>
+void bitwise(uint64_t *dst, const uint64_t *src, size_t n) {
+#if defined(__GNUC__)
+#if defined(__x86_64__) || defined(__i386__)
+  if (active_isa() == isa::avx2) {
+    bitwise_avx2<Op>(dst, src, n);
+    return;
+  }
+#endif
+  if (active_isa() != isa::scalar) {
+    bitwise_kernel<Op, 16>(dst, src, n);
+    return;
+  }
+#endif
+  for (size_t i = 0; i < n; i++) apply_bit_op<Op>(dst[i], src[i]);
+}
+}  // namespace detail
+
+// Побитовые операции над n словами: dst op= src. Ими пользуются битовые
+// множества s21::bitset и s21::dynamic_bitset
+inline void bit_and(uint64_t *dst, const uint64_t *src, size_t n) {
+  detail::bitwise<detail::bit_op::op_and>(dst, src, n);
+}
+
+inline void bit_or(uint64_t *dst, const uint64_t *src, size_t n) {
+  detail::bitwise<detail::bit_op::op_or>(dst, src, n);
+}
+
+inline void bit_xor(uint64_t *dst, const uint64_t *src, size_t n) {
+  detail::bitwise<detail::bit_op::op_xor>(dst, src, n);
+}
+
+// dst &= ~src: разность множеств
+inline void bit_and_not(uint64_t *dst, const uint64_t *src, size_t n) {
+  detail::bitwise<detail::bit_op::op_and_not>(dst, src, n);
+}
+
+inline void bit_not(uint64_t *dst, size_t n) {
+#if defined(__GNUC__)
+#if defined(__x86_64__) || defined(__i386__)
+  if (active_isa() == isa::avx2) {
+    detail::not_avx2(dst, n);
+    return;
+  }
+#endif
+  if (active_isa() != isa::scalar) {
+    detail::not_kernel<16>(dst, n);
+    return;
+  }
+#endif
+  for (size_t i = 0; i < n; i++) dst[i] = ~dst[i];
+}
+
+// Число единичных битов в n словах
+inline size_t popcount(const uint64_t *words, size_t n) {
+#if defined(__GNUC__)
+#if defined(__x86_64__) || defined(__i386__)
+  if (active_isa() == isa::avx2) return detail::popcount_avx2(words, n);
+#endif
+  if (active_isa() != isa::scalar) {
+    return detail::popcount_kernel<16>(words, n);
+  }
+#endif
+  size_t total = 0;
+  for (size_t i = 0; i < n; i++) {
+    for (uint64_t w = words[i]; w; w &= w - 1) total++;
+  }
+  return total;
+}
+
+// Те же алгоритмы для непрерывных контейнеров с data() и size():
+// s21::vector, s21::small_vector, s21::array и временных видов s21::span
+template <class C>
+using value_of = typename std::remove_reference_t<C>::value_type;
+
+template <class C>
+auto find(C &&c, const value_of<C> &value) {
+  auto *first = c.data();
+  return c.begin() + (find(first, first + c.size(), value) - first);
+}
+
+template <class C>
+size_t count(C &&c, const value_of<C> &value) {
+  return count(c.data(), c.data() + c.size(), value);
+}
+
+template <class C>
+void fill(C &&c, const value_of<C> &value) {
+  fill(c.data(), c.data() + c.size(), value);
+}
+
+template <class C1, class C2>
+bool equal(C1 &&a, C2 &&b) {
+  return a.size() == b.size() && equal(a.data(), b.data(), a.size());
+}
+
+template <class C>
+value_of<C> min(C &&c) {
+  return min(c.data(), c.data() + c.size());
+}
+
+template <class C>
+value_of<C> max(C &&c) {
+  return max(c.data(), c.data() + c.size());
+}
+
+template <class C>
+sum_type<value_of<C>> sum(C &&c) {
+  return sum(c.data(), c.data() + c.size());
+}
+
+}  // namespace simd
+}  // namespace s21
+
+#endif  // SRC_S21_SIMD_HPP_
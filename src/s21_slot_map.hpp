@@ -0,0 +1,206 @@
+#ifndef SRC_S21_SLOT_MAP_HPP_
+#define SRC_S21_SLOT_MAP_HPP_
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_vector.hpp"
+
+namespace s21 {
+
+// Ключ элемента slot_map: номер ячейки и её поколение на момент вставки
+struct slot_handle {
+  uint32_t index{std::numeric_limits<uint32_t>::max()};
+  uint32_t generation{0};
+
+  bool operator==(const slot_handle &other) const {
+    return index == other.index && generation == other.generation;
+  }
+  bool operator!=(const slot_handle &other) const {
+    return !(*this == other);
+  }
+};
+
+// Хранилище со стабильными ключами: значения лежат подряд в s21::vector,
+// а ключ указывает на ячейку, которая знает, где сейчас значение.
+// Удаление переносит последнее значение на место удалённого и поправляет
+// его ячейку, освобождённая ячейка уходит в список свободных и получает
+// новое поколение - старые ключи к ней перестают подходить. Вставка,
+// удаление и поиск - O(1), обход идёт по плотному массиву. Порядок
+// значений при удалении меняется
+template <class T>
+class slot_map {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using handle = slot_handle;
+  using iterator = typename vector<T>::iterator;
+  using const_iterator = typename vector<T>::const_iterator;
+
+  slot_map() = default;
+
+  handle insert(const T &value) { return emplace(value); }
+  handle insert(T &&value) { return emplace(std::move(value)); }
+  template <typename... Args>
+  handle emplace(Args &&...args);
+  // Удаляет значение по ключу; false, если ключ устарел
+  bool erase(handle h);
+  void clear();
+
+  bool contains(handle h) const { return slot_of(h) != nullptr; }
+  // Значение по ключу или nullptr, если ключ устарел
+  T *get(handle h);
+  const T *get(handle h) const;
+  reference at(handle h);
+  const_reference at(handle h) const;
+  // Без проверки поколения
+  reference operator[](handle h) { return values_[slots_[h.index].target]; }
+  const_reference operator[](handle h) const {
+    return values_[slots_[h.index].target];
+  }
+  // Ключ значения, лежащего на месте pos плотного массива
+  handle handle_at(size_type pos) const;
+
+  iterator begin() { return values_.begin(); }
+  iterator end() { return values_.end(); }
+  const_iterator begin() const { return values_.begin(); }
+  const_iterator end() const { return values_.end(); }
+  T *data() { return values_.data(); }
+  const T *data() const { return values_.data(); }
+
+  bool empty() const { return values_.empty(); }
+  size_type size() const { return values_.size(); }
+  // Число ячеек: занятые и свободные
+  size_type slot_count() const { return slots_.size(); }
+  void reserve(size_type n);
+
+ private:
+  static constexpr uint32_t kNone = std::numeric_limits<uint32_t>::max();
+
+  // У занятой ячейки target - место значения в values_, у свободной -
+  // следующая свободная ячейка
+  struct slot {
+    uint32_t target;
+    uint32_t generation;
+  };
+
+  vector<T> values_;
+  // Ячейка каждого значения: нужна, чтобы поправить её при переносе
+  vector<uint32_t> owners_;
+  vector<slot> slots_;
+  uint32_t free_head_{kNone};
+
+  const slot *slot_of(handle h) const;
+  // Освобождает ячейку и меняет её поколение
+  void release(uint32_t index);
+};
+
+template <class T>
+template <typename... Args>
+typename slot_map<T>::handle slot_map<T>::emplace(Args &&...args) {
+  if (values_.size() >= kNone) throw std::length_error("slot_map");
+  if (free_head_ == kNone) {
+    slots_.push_back(slot{kNone, 0});
+    free_head_ = static_cast<uint32_t>(slots_.size() - 1);
+  }
+  uint32_t index = free_head_;
+  values_.emplace_back(std::forward<Args>(args)...);
+  try {
+    owners_.push_back(index);
+  } catch (...) {
+    values_.pop_back();
+    throw;
+  }
+  free_head_ = slots_[index].target;
+  slots_[index].target = static_cast<uint32_t>(values_.size() - 1);
+  return handle{index, slots_[index].generation};
+}
+
+template <class T>
+bool slot_map<T>::erase(handle h) {
+  if (!slot_of(h)) return false;
+  uint32_t pos = slots_[h.index].target;
+  uint32_t last = static_cast<uint32_t>(values_.size() - 1);
+  if (pos != last) {
+    values_[pos] = std::move(values_[last]);
+    owners_[pos] = owners_[last];
+    slots_[owners_[pos]].target = pos;
+  }
+  values_.pop_back();
+  owners_.pop_back();
+  release(h.index);
+  return true;
+}
+
+template <class T>
+void slot_map<T>::clear() {
+  for (size_type pos = 0; pos < owners_.size(); pos++) release(owners_[pos]);
+  values_.clear();
+  owners_.clear();
+}
+
+template <class T>
+T *slot_map<T>::get(handle h) {
+  const slot *s = slot_of(h);
+  return s ? &values_[s->target] : nullptr;
+}
+
+template <class T>
+const T *slot_map<T>::get(handle h) const {
+  const slot *s = slot_of(h);
+  return s ? &values_[s->target] : nullptr;
+}
+
+template <class T>
+typename slot_map<T>::reference slot_map<T>::at(handle h) {
+  T *value = get(h);
+  if (!value) throw std::out_of_range("stale slot_map handle");
+  return *value;
+}
+
+template <class T>
+typename slot_map<T>::const_reference slot_map<T>::at(handle h) const {
+  const T *value = get(h);
+  if (!value) throw std::out_of_range("stale slot_map handle");
+  return *value;
+}
+
+template <class T>
+typename slot_map<T>::handle slot_map<T>::handle_at(size_type pos) const {
+  if (pos >= values_.size()) throw std::out_of_range("Index out of range");
+  uint32_t index = owners_[pos];
+  return handle{index, slots_[index].generation};
+}
+
+template <class T>
+void slot_map<T>::reserve(size_type n) {
+  values_.reserve(n);
+  owners_.reserve(n);
+  slots_.reserve(n);
+}
+
+// Ячейка занята, если поколение совпало: у свободной оно уже другое
+template <class T>
+const typename slot_map<T>::slot *slot_map<T>::slot_of(handle h) const {
+  if (h.index >= slots_.size()) return nullptr;
+  const slot &s = slots_[h.index];
+  return s.generation == h.generation && s.target < values_.size() &&
+                 owners_[s.target] == h.index
+             ? &s
+             : nullptr;
+}
+
+template <class T>
+void slot_map<T>::release(uint32_t index) {
+  slots_[index].generation++;
+  slots_[index].target = free_head_;
+  free_head_ = index;
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_SLOT_MAP_HPP_
@@ -0,0 +1,487 @@
+#ifndef SRC_S21_SMALL_VECTOR_HPP_
+#define SRC_S21_SMALL_VECTOR_HPP_
+
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.hpp"
+
+namespace s21 {
+
+// Вектор с интерфейсом s21::vector, первые N элементов которого лежат
+// внутри объекта: куча нужна только при росте за N. В отличие от vector,
+// clear() не освобождает память, а перемещение объекта, у которого
+// элементы внутри, переносит их поэлементно
+template <typename T, size_t N = 8>
+class small_vector {
+  static_assert(N > 0, "small_vector needs inline capacity");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using iterator = typename vector<T>::iterator;
+  using const_iterator = typename vector<T>::const_iterator;
+
+  small_vector() : arr_(inline_data()), size_(0), capacity_(N) {}
+  explicit small_vector(size_type n);
+  small_vector(std::initializer_list<value_type> const &items);
+  small_vector(const small_vector &v);
+  small_vector(small_vector &&v);
+  ~small_vector();
+  small_vector &operator=(const small_vector &v);
+  small_vector &operator=(small_vector &&v);
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  T &operator[](size_type pos) { return arr_[pos]; }
+  const T &operator[](size_type pos) const { return arr_[pos]; }
+  const_reference front() const { return arr_[0]; }
+  const_reference back() const { return arr_[size_ - 1]; }
+  T *data() { return arr_; }
+  const T *data() const { return arr_; }
+
+  iterator begin() { return iterator(arr_); }
+  iterator end() { return iterator(arr_ + size_); }
+  const_iterator begin() const { return const_iterator(arr_); }
+  const_iterator end() const { return const_iterator(arr_ + size_); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type max_size() const;
+  size_type capacity() const { return capacity_; }
+  // Лежат ли элементы внутри объекта
+  bool is_inline() const { return arr_ == inline_data(); }
+  static constexpr size_type inline_capacity() { return N; }
+  void reserve(size_type size);
+  void shrink_to_fit();
+
+  void clear();
+  iterator insert(const_iterator pos, const_reference value);
+  iterator insert(const_iterator pos, T &&value);
+  iterator insert(const_iterator pos, size_type count, const_reference value);
+  template <class InputIt,
+            std::enable_if_t<!std::is_integral<InputIt>::value, int> = 0>
+  iterator insert(const_iterator pos, InputIt first, InputIt last);
+  iterator insert(const_iterator pos, std::initializer_list<value_type> items);
+  iterator erase(const_iterator pos);
+  iterator erase(const_iterator first, const_iterator last);
+  void assign(size_type count, const_reference value);
+  template <class InputIt,
+            std::enable_if_t<!std::is_integral<InputIt>::value, int> = 0>
+  void assign(InputIt first, InputIt last);
+  void assign(std::initializer_list<value_type> items);
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(T &&value) { emplace_back(std::move(value)); }
+  void pop_back();
+  void resize(size_type count);
+  void resize(size_type count, const_reference value);
+  void swap(small_vector &other);
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
+
+ private:
+  T *arr_;
+  size_type size_;
+  size_type capacity_;
+  alignas(T) unsigned char buffer_[N * sizeof(T)];
+
+  T *inline_data() { return reinterpret_cast<T *>(buffer_); }
+  const T *inline_data() const {
+    return reinterpret_cast<const T *>(buffer_);
+  }
+  static T *allocate(size_type n);
+  static void deallocate(T *p);
+  static void destroy(T *first, T *last);
+  // Переносит n элементов в неинициализированную dst; исходные разрушает
+  // вызывающий
+  static void relocate(T *src, size_type n, T *dst);
+  // Освобождает кучу, если элементы не внутри объекта
+  void release();
+  // Вместимость при росте до need: удвоение, но не больше max_size()
+  size_type grow_capacity(size_type need) const;
+  // Переезжает в кучу вместимостью n
+  void reallocate(size_type n);
+  // Забирает содержимое v, оставляя его пустым
+  void take(small_vector &v);
+};
+
+template <typename T, size_t N>
+small_vector<T, N>::small_vector(size_type n) : small_vector() {
+  resize(n);
+}
+
+template <typename T, size_t N>
+small_vector<T, N>::small_vector(
+    std::initializer_list<value_type> const &items)
+    : small_vector() {
+  reserve(items.size());
+  for (auto &elem : items) push_back(elem);
+}
+
+template <typename T, size_t N>
+small_vector<T, N>::small_vector(const small_vector &v) : small_vector() {
+  reserve(v.size_);
+  for (size_type i = 0; i < v.size_; i++) push_back(v.arr_[i]);
+}
+
+template <typename T, size_t N>
+small_vector<T, N>::small_vector(small_vector &&v) : small_vector() {
+  take(v);
+}
+
+template <typename T, size_t N>
+small_vector<T, N>::~small_vector() {
+  destroy(arr_, arr_ + size_);
+  release();
+}
+
+template <typename T, size_t N>
+small_vector<T, N> &small_vector<T, N>::operator=(const small_vector &v) {
+  if (this != &v) {
+    small_vector tmp(v);
+    clear();
+    take(tmp);
+  }
+  return *this;
+}
+
+template <typename T, size_t N>
+small_vector<T, N> &small_vector<T, N>::operator=(small_vector &&v) {
+  if (this != &v) {
+    clear();
+    take(v);
+  }
+  return *this;
+}
+
+template <typename T, size_t N>
+typename small_vector<T, N>::reference small_vector<T, N>::at(
+    size_type pos) {
+  if (pos >= size_) throw std::out_of_range("small_vector::at");
+  return arr_[pos];
+}
+
+template <typename T, size_t N>
+typename small_vector<T, N>::const_reference small_vector<T, N>::at(
+    size_type pos) const {
+  if (pos >= size_) throw std::out_of_range("small_vector::at");
+  return arr_[pos];
+}
+
+template <typename T, size_t N>
+typename small_vector<T, N>::size_type small_vector<T, N>::max_size() const {
+  return std::numeric_limits<size_type>::max() / sizeof(T);
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::reserve(size_type size) {
+  if (size > max_size()) throw std::length_error("small_vector::reserve");
+  if (size > capacity_) reallocate(size);
+}
+
+// Возвращает элементы внутрь объекта, если они там помещаются
+template <typename T, size_t N>
+void small_vector<T, N>::shrink_to_fit() {
+  if (is_inline() || size_ == capacity_) return;
+  if (size_ <= N) {
+    T *old = arr_;
+    relocate(old, size_, inline_data());
+    destroy(old, old + size_);
+    deallocate(old);
+    arr_ = inline_data();
+    capacity_ = N;
+  } else {
+    reallocate(size_);
+  }
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::clear() {
+  destroy(arr_, arr_ + size_);
+  size_ = 0;
+}
+
+template <typename T, size_t N>
+typename small_vector<T, N>::iterator small_vector<T, N>::insert(
+    const_iterator pos, const T &value) {
+  return emplace(pos, value);
+}
+
+template <typename T, size_t N>
+typename small_vector<T, N>::iterator small_vector<T, N>::insert(
+    const_iterator pos, T &&value) {
+  return emplace(pos, std::move(value));
+}
+
+// Копии добавляются в конец и поворотом ставятся на место; value может
+// ссылаться на элемент этого же вектора
+template <typename T, size_t N>
+typename small_vector<T, N>::iterator small_vector<T, N>::insert(
+    const_iterator pos, size_type count, const_reference value) {
+  size_type idx = pos.array_ - arr_;
+  if (!count) return iterator(arr_ + idx);
+  T tmp(value);
+  if (count > max_size() - size_) throw std::length_error("small_vector");
+  if (size_ + count > capacity_) reallocate(grow_capacity(size_ + count));
+  size_type old_size = size_;
+  try {
+    while (size_ < old_size + count) emplace_back(tmp);
+  } catch (...) {
+    while (size_ > old_size) pop_back();
+    throw;
+  }
+  std::rotate(arr_ + idx, arr_ + old_size, arr_ + size_);
+  return iterator(arr_ + idx);
+}
+
+// Диапазон добавляется в конец и поворотом ставится на место
+template <typename T, size_t N>
+template <class InputIt,
+          std::enable_if_t<!std::is_integral<InputIt>::value, int>>
+typename small_vector<T, N>::iterator small_vector<T, N>::insert(
+    const_iterator pos, InputIt first, InputIt last) {
+  size_type idx = pos.array_ - arr_;
+  size_type old_size = size_;
+  try {
+    for (; first != last; ++first) emplace_back(*first);
+  } catch (...) {
+    while (size_ > old_size) pop_back();
+    throw;
+  }
+  std::rotate(arr_ + idx, arr_ + old_size, arr_ + size_);
+  return iterator(arr_ + idx);
+}
+
+template <typename T, size_t N>
+typename small_vector<T, N>::iterator small_vector<T, N>::insert(
+    const_iterator pos, std::initializer_list<value_type> items) {
+  return insert(pos, items.begin(), items.end());
+}
+
+template <typename T, size_t N>
+typename small_vector<T, N>::iterator small_vector<T, N>::erase(
+    const_iterator pos) {
+  return erase(pos, pos + 1);
+}
+
+template <typename T, size_t N>
+typename small_vector<T, N>::iterator small_vector<T, N>::erase(
+    const_iterator first, const_iterator last) {
+  T *from = arr_ + (first.array_ - arr_);
+  T *to = arr_ + (last.array_ - arr_);
+  if (from != to) {
+    T *new_end = std::move(to, arr_ + size_, from);
+    destroy(new_end, arr_ + size_);
+    size_ = new_end - arr_;
+  }
+  return iterator(from);
+}
+
+// Заменяет содержимое; память сохраняется, если её хватает
+template <typename T, size_t N>
+void small_vector<T, N>::assign(size_type count, const_reference value) {
+  T tmp(value);
+  clear();
+  reserve(count);
+  while (size_ < count) emplace_back(tmp);
+}
+
+template <typename T, size_t N>
+template <class InputIt,
+          std::enable_if_t<!std::is_integral<InputIt>::value, int>>
+void small_vector<T, N>::assign(InputIt first, InputIt last) {
+  clear();
+  if constexpr (is_forward_iterator<InputIt>::value) {
+    reserve(std::distance(first, last));
+  }
+  for (; first != last; ++first) emplace_back(*first);
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::assign(std::initializer_list<value_type> items) {
+  assign(items.begin(), items.end());
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::pop_back() {
+  if (size_) arr_[--size_].~T();
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::resize(size_type count) {
+  if (count < size_) {
+    destroy(arr_ + count, arr_ + size_);
+    size_ = count;
+    return;
+  }
+  reserve(count);
+  while (size_ < count) emplace_back();
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::resize(size_type count, const_reference value) {
+  if (count < size_) {
+    destroy(arr_ + count, arr_ + size_);
+    size_ = count;
+    return;
+  }
+  if (count > size_) insert(end(), count - size_, value);
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::swap(small_vector &other) {
+  if (this == &other) return;
+  small_vector tmp(std::move(other));
+  other = std::move(*this);
+  *this = std::move(tmp);
+}
+
+// Новый элемент строится до сдвига хвоста: аргументы могут ссылаться на
+// элементы этого же вектора
+template <typename T, size_t N>
+template <typename... Args>
+typename small_vector<T, N>::iterator small_vector<T, N>::emplace(
+    const_iterator pos, Args &&...args) {
+  size_type idx = pos.array_ - arr_;
+  if (idx == size_) {
+    emplace_back(std::forward<Args>(args)...);
+    return iterator(arr_ + idx);
+  }
+  T tmp(std::forward<Args>(args)...);
+  if (size_ == capacity_) reallocate(grow_capacity(size_ + 1));
+  new (arr_ + size_) T(std::move(arr_[size_ - 1]));
+  size_++;
+  std::move_backward(arr_ + idx, arr_ + size_ - 2, arr_ + size_ - 1);
+  arr_[idx] = std::move(tmp);
+  return iterator(arr_ + idx);
+}
+
+template <typename T, size_t N>
+template <typename... Args>
+typename small_vector<T, N>::reference small_vector<T, N>::emplace_back(
+    Args &&...args) {
+  if (size_ == capacity_) {
+    T tmp(std::forward<Args>(args)...);
+    reallocate(grow_capacity(size_ + 1));
+    new (arr_ + size_) T(std::move(tmp));
+  } else {
+    new (arr_ + size_) T(std::forward<Args>(args)...);
+  }
+  return arr_[size_++];
+}
+
+template <typename T, size_t N>
+T *small_vector<T, N>::allocate(size_type n) {
+  if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+    return static_cast<T *>(
+        ::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+  } else {
+    return static_cast<T *>(::operator new(n * sizeof(T)));
+  }
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::deallocate(T *p) {
+  if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+    ::operator delete(p, std::align_val_t(alignof(T)));
+  } else {
+    ::operator delete(p);
+  }
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::destroy(T *first, T *last) {
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    for (; first != last; ++first) first->~T();
+  }
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::relocate(T *src, size_type n, T *dst) {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    if (n) std::memcpy(static_cast<void *>(dst), src, n * sizeof(T));
+  } else {
+    size_type i = 0;
+    try {
+      for (; i < n; i++) new (dst + i) T(std::move_if_noexcept(src[i]));
+    } catch (...) {
+      destroy(dst, dst + i);
+      throw;
+    }
+  }
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::release() {
+  if (!is_inline()) deallocate(arr_);
+  arr_ = inline_data();
+  capacity_ = N;
+}
+
+template <typename T, size_t N>
+typename small_vector<T, N>::size_type small_vector<T, N>::grow_capacity(
+    size_type need) const {
+  if (need > max_size()) throw std::length_error("small_vector");
+  size_type grown = 2 * capacity_;
+  if (grown < capacity_ || grown > max_size()) grown = max_size();
+  return grown < need ? need : grown;
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::reallocate(size_type n) {
+  T *newarr = allocate(n);
+  try {
+    relocate(arr_, size_, newarr);
+  } catch (...) {
+    deallocate(newarr);
+    throw;
+  }
+  destroy(arr_, arr_ + size_);
+  if (!is_inline()) deallocate(arr_);
+  arr_ = newarr;
+  capacity_ = n;
+}
+
+// Кучу забираем целиком, элементы изнутри объекта переносим по одному
+template <typename T, size_t N>
+void small_vector<T, N>::take(small_vector &v) {
+  release();
+  if (v.is_inline()) {
+    relocate(v.arr_, v.size_, inline_data());
+    destroy(v.arr_, v.arr_ + v.size_);
+  } else {
+    arr_ = v.arr_;
+    capacity_ = v.capacity_;
+    v.arr_ = v.inline_data();
+    v.capacity_ = N;
+  }
+  size_ = v.size_;
+  v.size_ = 0;
+}
+
+// Удаляет элементы, для которых pred истинен. Возвращает число удалённых
+template <typename T, size_t N, class Pred>
+typename small_vector<T, N>::size_type erase_if(small_vector<T, N> &vec,
+                                                Pred pred) {
+  auto new_end = std::remove_if(vec.begin(), vec.end(), pred);
+  typename small_vector<T, N>::size_type removed = vec.end() - new_end;
+  vec.erase(new_end, vec.end());
+  return removed;
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_SMALL_VECTOR_HPP_
@@ -0,0 +1,274 @@
+#ifndef SRC_S21_SOA_VECTOR_HPP_
+#define SRC_S21_SOA_VECTOR_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "s21_span.hpp"
+#include "s21_vector.hpp"
+
+namespace s21 {
+
+// Массив структур, разложенный по столбцам: поле I всех элементов лежит в
+// своём s21::vector. Элемент добавляется и читается целиком, как кортеж
+// полей, а проход по одному полю читает только его столбец, поэтому в
+// кеш не попадают остальные поля и цикл векторизуется. operator[]
+// возвращает кортеж ссылок на поля: его можно присвоить кортежу значений
+// и разобрать структурной привязкой
+template <class... Fields>
+class soa_vector {
+  static_assert(sizeof...(Fields) > 0, "soa_vector needs at least one field");
+
+ public:
+  using value_type = std::tuple<Fields...>;
+  using reference = std::tuple<Fields &...>;
+  using const_reference = std::tuple<const Fields &...>;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  template <size_t I>
+  using field_type = std::tuple_element_t<I, value_type>;
+
+  // Итератор по элементам; разыменование даёт кортеж ссылок
+  template <bool Const>
+  class basic_iterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = soa_vector::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference =
+        std::conditional_t<Const, soa_vector::const_reference,
+                           soa_vector::reference>;
+    using pointer = void;
+    using owner = std::conditional_t<Const, const soa_vector, soa_vector>;
+
+    basic_iterator() = default;
+    basic_iterator(owner *soa, size_type pos) : soa_(soa), pos_(pos) {}
+    template <bool Other, std::enable_if_t<Const && !Other, int> = 0>
+    basic_iterator(const basic_iterator<Other> &it)
+        : soa_(it.soa_), pos_(it.pos_) {}
+
+    reference operator*() const { return (*soa_)[pos_]; }
+    reference operator[](difference_type n) const {
+      return (*soa_)[pos_ + n];
+    }
+    basic_iterator &operator++() {
+      ++pos_;
+      return *this;
+    }
+    basic_iterator &operator--() {
+      --pos_;
+      return *this;
+    }
+    basic_iterator operator++(int) { return {soa_, pos_++}; }
+    basic_iterator operator--(int) { return {soa_, pos_--}; }
+    basic_iterator &operator+=(difference_type n) {
+      pos_ += n;
+      return *this;
+    }
+    basic_iterator &operator-=(difference_type n) {
+      pos_ -= n;
+      return *this;
+    }
+    basic_iterator operator+(difference_type n) const {
+      return {soa_, pos_ + n};
+    }
+    basic_iterator operator-(difference_type n) const {
+      return {soa_, pos_ - n};
+    }
+    difference_type operator-(const basic_iterator &it) const {
+      return static_cast<difference_type>(pos_) -
+             static_cast<difference_type>(it.pos_);
+    }
+    bool operator==(const basic_iterator &it) const { return pos_ == it.pos_; }
+    bool operator!=(const basic_iterator &it) const { return pos_ != it.pos_; }
+    bool operator<(const basic_iterator &it) const { return pos_ < it.pos_; }
+    bool operator>(const basic_iterator &it) const { return pos_ > it.pos_; }
+    bool operator<=(const basic_iterator &it) const { return pos_ <= it.pos_; }
+    bool operator>=(const basic_iterator &it) const { return pos_ >= it.pos_; }
+
+   private:
+    friend class basic_iterator<!Const>;
+
+    owner *soa_{nullptr};
+    size_type pos_{0};
+  };
+  using iterator = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+
+  soa_vector() = default;
+  explicit soa_vector(size_type n) { resize(n); }
+
+  reference operator[](size_type pos) {
+    return row(pos, std::index_sequence_for<Fields...>());
+  }
+  const_reference operator[](size_type pos) const {
+    return row(pos, std::index_sequence_for<Fields...>());
+  }
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference front() { return (*this)[0]; }
+  reference back() { return (*this)[size() - 1]; }
+
+  // Поле I элемента pos
+  template <size_t I>
+  field_type<I> &get(size_type pos) {
+    return std::get<I>(columns_)[pos];
+  }
+  template <size_t I>
+  const field_type<I> &get(size_type pos) const {
+    return std::get<I>(columns_)[pos];
+  }
+  // Столбец поля I целиком
+  template <size_t I>
+  span<field_type<I>> column() {
+    auto &col = std::get<I>(columns_);
+    return {col.data(), col.size()};
+  }
+  template <size_t I>
+  span<const field_type<I>> column() const {
+    const auto &col = std::get<I>(columns_);
+    return {col.data(), col.size()};
+  }
+
+  iterator begin() { return {this, 0}; }
+  iterator end() { return {this, size()}; }
+  const_iterator begin() const { return {this, 0}; }
+  const_iterator end() const { return {this, size()}; }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  bool empty() const { return size() == 0; }
+  size_type size() const { return std::get<0>(columns_).size(); }
+  size_type capacity() const { return std::get<0>(columns_).capacity(); }
+  void reserve(size_type n);
+  void shrink_to_fit();
+
+  void clear();
+  void push_back(const value_type &value);
+  void push_back(value_type &&value);
+  // Добавляет элемент из значений полей
+  template <class... Args>
+  reference emplace_back(Args &&...args);
+  void pop_back();
+  iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+  iterator erase(const_iterator first, const_iterator last);
+  void resize(size_type n);
+  void swap(soa_vector &other) { std::swap(columns_, other.columns_); }
+
+ private:
+  std::tuple<vector<Fields>...> columns_;
+
+  template <size_t... I>
+  reference row(size_type pos, std::index_sequence<I...>) {
+    return reference(std::get<I>(columns_)[pos]...);
+  }
+  template <size_t... I>
+  const_reference row(size_type pos, std::index_sequence<I...>) const {
+    return const_reference(std::get<I>(columns_)[pos]...);
+  }
+  // Вызывает f для каждого столбца
+  template <class F>
+  void each_column(F &&f) {
+    std::apply([&](auto &...col) { (f(col), ...); }, columns_);
+  }
+  // Если добавление в один из столбцов бросило, уже дополненные
+  // укорачиваются обратно, чтобы столбцы не разошлись по длине
+  template <class Tuple, size_t... I>
+  void append(Tuple &&values, std::index_sequence<I...>);
+};
+
+template <class... Fields>
+typename soa_vector<Fields...>::reference soa_vector<Fields...>::at(
+    size_type pos) {
+  if (pos >= size()) throw std::out_of_range("Index out of range");
+  return (*this)[pos];
+}
+
+template <class... Fields>
+typename soa_vector<Fields...>::const_reference soa_vector<Fields...>::at(
+    size_type pos) const {
+  if (pos >= size()) throw std::out_of_range("Index out of range");
+  return (*this)[pos];
+}
+
+template <class... Fields>
+void soa_vector<Fields...>::reserve(size_type n) {
+  each_column([n](auto &col) { col.reserve(n); });
+}
+
+template <class... Fields>
+void soa_vector<Fields...>::shrink_to_fit() {
+  each_column([](auto &col) { col.shrink_to_fit(); });
+}
+
+template <class... Fields>
+void soa_vector<Fields...>::clear() {
+  each_column([](auto &col) { col.clear(); });
+}
+
+template <class... Fields>
+void soa_vector<Fields...>::push_back(const value_type &value) {
+  append(value, std::index_sequence_for<Fields...>());
+}
+
+template <class... Fields>
+void soa_vector<Fields...>::push_back(value_type &&value) {
+  append(std::move(value), std::index_sequence_for<Fields...>());
+}
+
+template <class... Fields>
+template <class... Args>
+typename soa_vector<Fields...>::reference soa_vector<Fields...>::emplace_back(
+    Args &&...args) {
+  static_assert(sizeof...(Args) == sizeof...(Fields),
+                "emplace_back takes one value per field");
+  append(std::forward_as_tuple(std::forward<Args>(args)...),
+         std::index_sequence_for<Fields...>());
+  return back();
+}
+
+template <class... Fields>
+template <class Tuple, size_t... I>
+void soa_vector<Fields...>::append(Tuple &&values,
+                                   std::index_sequence<I...>) {
+  size_type old_size = size();
+  try {
+    (std::get<I>(columns_).emplace_back(
+         std::get<I>(std::forward<Tuple>(values))),
+     ...);
+  } catch (...) {
+    each_column([old_size](auto &col) {
+      if (col.size() > old_size) col.pop_back();
+    });
+    throw;
+  }
+}
+
+template <class... Fields>
+void soa_vector<Fields...>::pop_back() {
+  each_column([](auto &col) { col.pop_back(); });
+}
+
+template <class... Fields>
+typename soa_vector<Fields...>::iterator soa_vector<Fields...>::erase(
+    const_iterator first, const_iterator last) {
+  size_type from = static_cast<size_type>(first - cbegin());
+  size_type to = static_cast<size_type>(last - cbegin());
+  each_column([from, to](auto &col) {
+    col.erase(col.begin() + from, col.begin() + to);
+  });
+  return {this, from};
+}
+
+template <class... Fields>
+void soa_vector<Fields...>::resize(size_type n) {
+  each_column([n](auto &col) { col.resize(n); });
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_SOA_VECTOR_HPP_
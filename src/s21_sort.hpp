@@ -0,0 +1,342 @@
+#ifndef SRC_S21_SORT_HPP_
+#define SRC_S21_SORT_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "s21_simd.hpp"
+#include "s21_span.hpp"
+#include "s21_vector.hpp"
+
+namespace s21 {
+
+namespace sort_detail {
+
+// Куски не длиннее kNetwork досортировываются сетью сортировки
+constexpr ptrdiff_t kNetwork = 32;
+// Короче kRadixMin<T> поразрядная сортировка проигрывает интроспективной:
+// на каждый байт ключа приходится проход по 256 счётчикам
+template <class T>
+constexpr size_t kRadixMin = 32 * sizeof(T);
+
+// Поразрядно сортируются целые и числа с плавающей точкой до 8 байт
+template <class T>
+constexpr bool radix_sortable =
+    std::is_arithmetic<T>::value && !std::is_same<T, bool>::value &&
+    (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8) &&
+    (std::is_integral<T>::value || std::numeric_limits<T>::is_iec559);
+
+// Сравнение по умолчанию, при котором порядок совпадает с порядком ключей
+template <class Compare, class T>
+constexpr bool default_less = std::is_same<Compare, std::less<>>::value ||
+                              std::is_same<Compare, std::less<T>>::value;
+
+template <size_t S>
+struct unsigned_of;
+template <>
+struct unsigned_of<1> {
+  using type = uint8_t;
+};
+template <>
+struct unsigned_of<2> {
+  using type = uint16_t;
+};
+template <>
+struct unsigned_of<4> {
+  using type = uint32_t;
+};
+template <>
+struct unsigned_of<8> {
+  using type = uint64_t;
+};
+
+// Беззнаковый ключ, порядок которого совпадает с порядком значений. У
+// знаковых целых инвертируется знаковый бит. У отрицательных чисел с
+// плавающей точкой инвертируются все биты, у положительных - знаковый:
+// -0.0 встаёт перед +0.0, NaN со знаком - в начало, без знака - в конец
+template <class T>
+typename unsigned_of<sizeof(T)>::type radix_key(T value) {
+  using U = typename unsigned_of<sizeof(T)>::type;
+  constexpr U sign = U(U(1) << (sizeof(T) * 8 - 1));
+  U key;
+  std::memcpy(&key, &value, sizeof(T));
+  if (std::is_floating_point<T>::value) {
+    return (key & sign) ? U(~key) : U(key | sign);
+  }
+  return std::is_signed<T>::value ? U(key ^ sign) : key;
+}
+
+// Значение по ключу radix_key, биты восстанавливаются точно
+template <class T, class U>
+T radix_value(U key) {
+  constexpr U sign = U(U(1) << (sizeof(T) * 8 - 1));
+  if (std::is_floating_point<T>::value) {
+    key = (key & sign) ? U(key ^ sign) : U(~key);
+  } else if (std::is_signed<T>::value) {
+    key = U(key ^ sign);
+  }
+  T value;
+  std::memcpy(&value, &key, sizeof(T));
+  return value;
+}
+
+template <class It, class Compare>
+void insertion_sort(It first, It last, Compare &comp) {
+  if (first == last) return;
+  for (It i = first + 1; i != last; ++i) {
+    auto value = std::move(*i);
+    It j = i;
+    for (; j != first && comp(value, *(j - 1)); --j) *j = std::move(*(j - 1));
+    *j = std::move(value);
+  }
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+
+// 64-битные целые в сеть не идут: без SSE4.2 их сравнение в векторах
+// эмулируется и сеть медленнее вставок. Числа с плавающей точкой тоже: для
+// NaN и пары -0.0, +0.0 сравнение не даёт порядка, и дорожки пары
+// оставляли бы себе одно и то же значение. Они приходят в сеть
+// беззнаковыми ключами radix_key
+template <class T>
+constexpr bool network_sortable =
+    simd::detail::vectorizable<T> && std::is_integral<T>::value &&
+    sizeof(T) != 8;
+
+// Битоническая сеть на kNetwork элементов в 16-байтных векторах. Хвост
+// дополняется наибольшим значением, после сортировки первые n элементов -
+// исходные. Пары на расстоянии не меньше ширины вектора сравниваются
+// целыми векторами, ближние - внутри вектора через перестановку дорожек
+template <class T>
+void network_sort(T *first, ptrdiff_t n) {
+  using V = simd::detail::vec_t<T, 16>;
+  using M = simd::detail::mask_t<T, 16>;
+  using L = typename simd::detail::lane<sizeof(T)>::type;
+  constexpr ptrdiff_t lanes = 16 / sizeof(T);
+  constexpr ptrdiff_t blocks = kNetwork / lanes;
+  T buffer[kNetwork];
+  std::copy(first, first + n, buffer);
+  std::fill(buffer + n, buffer + kNetwork,
+            std::numeric_limits<T>::has_infinity
+                ? std::numeric_limits<T>::infinity()
+                : std::numeric_limits<T>::max());
+  V v[blocks];
+  for (ptrdiff_t b = 0; b < blocks; b++) {
+    simd::detail::load(v[b], buffer + b * lanes);
+  }
+  M iota;
+  for (ptrdiff_t i = 0; i < lanes; i++) iota[i] = static_cast<L>(i);
+  for (ptrdiff_t k = 2; k <= kNetwork; k *= 2) {
+    for (ptrdiff_t j = k / 2; j > 0; j /= 2) {
+      if (j >= lanes) {
+        ptrdiff_t step = j / lanes;
+        for (ptrdiff_t b = 0; b < blocks; b++) {
+          if (b & step) continue;
+          V lo = v[b] < v[b + step] ? v[b] : v[b + step];
+          V hi = v[b] < v[b + step] ? v[b + step] : v[b];
+          bool up = ((b * lanes) & k) == 0;
+          v[b] = up ? lo : hi;
+          v[b + step] = up ? hi : lo;
+        }
+      } else {
+        M partner = iota ^ static_cast<L>(j);
+        for (ptrdiff_t b = 0; b < blocks; b++) {
+          V other = __builtin_shuffle(v[b], partner);
+          V lo = v[b] < other ? v[b] : other;
+          V hi = v[b] < other ? other : v[b];
+          M index = iota + static_cast<L>(b * lanes);
+          M take_lo = ((index & static_cast<L>(j)) == 0) ==
+                      ((index & static_cast<L>(k)) == 0);
+          v[b] = take_lo ? lo : hi;
+        }
+      }
+    }
+  }
+  std::memcpy(buffer, v, sizeof(buffer));
+  std::copy(buffer, buffer + n, first);
+}
+
+#else
+
+template <class T>
+constexpr bool network_sortable = false;
+
+template <class T>
+void network_sort(T *first, ptrdiff_t n) {
+  std::less<> comp;
+  insertion_sort(first, first + n, comp);
+}
+
+#endif
+
+template <class It, class Compare>
+void small_sort(It first, It last, Compare &comp) {
+  using T = typename std::iterator_traits<It>::value_type;
+  if constexpr (std::is_pointer<It>::value && network_sortable<T> &&
+                default_less<Compare, T>) {
+    network_sort(first, last - first);
+  } else {
+    insertion_sort(first, last, comp);
+  }
+}
+
+// Медиана второго, среднего и последнего элементов переносится в начало
+template <class It, class Compare>
+void median_to_first(It first, It last, Compare &comp) {
+  It a = first + 1;
+  It b = first + (last - first) / 2;
+  It c = last - 1;
+  if (comp(*a, *b)) {
+    if (comp(*b, *c)) {
+      std::iter_swap(first, b);
+    } else if (comp(*a, *c)) {
+      std::iter_swap(first, c);
+    } else {
+      std::iter_swap(first, a);
+    }
+  } else if (comp(*a, *c)) {
+    std::iter_swap(first, a);
+  } else if (comp(*b, *c)) {
+    std::iter_swap(first, c);
+  } else {
+    std::iter_swap(first, b);
+  }
+}
+
+// Разбиение Хоара вокруг *first; возвращает начало правой части
+template <class It, class Compare>
+It hoare_partition(It first, It last, Compare &comp) {
+  It left = first + 1;
+  It right = last;
+  for (;;) {
+    while (comp(*left, *first)) ++left;
+    --right;
+    while (comp(*first, *right)) --right;
+    if (!(left < right)) return left;
+    std::iter_swap(left, right);
+    ++left;
+  }
+}
+
+// Быстрая сортировка с рекурсией в правую часть и циклом по левой. Если
+// глубина исчерпана, разбиения вырождены, и кусок досортировывается
+// пирамидой - время остаётся O(n log n)
+template <class It, class Compare>
+void introsort_loop(It first, It last, size_t depth, Compare &comp) {
+  while (last - first > kNetwork) {
+    if (depth == 0) {
+      std::make_heap(first, last, comp);
+      std::sort_heap(first, last, comp);
+      return;
+    }
+    depth--;
+    median_to_first(first, last, comp);
+    It cut = hoare_partition(first, last, comp);
+    introsort_loop(cut, last, depth, comp);
+    last = cut;
+  }
+  small_sort(first, last, comp);
+}
+
+template <class It, class Compare>
+void introsort(It first, It last, Compare &comp) {
+  size_t depth = 0;
+  for (auto n = last - first; n > 1; n /= 2) depth += 2;
+  introsort_loop(first, last, depth, comp);
+}
+
+}  // namespace sort_detail
+
+// Поразрядная сортировка по младшим разрядам для целых и чисел с
+// плавающей точкой: проходы по байтам ключа из буфера в диапазон и
+// обратно. Гистограммы всех байтов считаются за один проход, байты,
+// одинаковые у всех ключей, пропускаются. Короткие диапазоны сортируются
+// интроспективно
+template <class T>
+void radix_sort(T *first, T *last) {
+  static_assert(sort_detail::radix_sortable<T>,
+                "radix_sort needs integer or IEEE floating point keys");
+  using U = typename sort_detail::unsigned_of<sizeof(T)>::type;
+  size_t n = static_cast<size_t>(last - first);
+  // Короткий диапазон сортируется интроспективно по тем же ключам, что и
+  // длинный, поэтому порядок NaN и нулей не зависит от длины
+  if (n < sort_detail::kRadixMin<T>) {
+    U keys[sort_detail::kRadixMin<T>];
+    for (size_t i = 0; i < n; i++) keys[i] = sort_detail::radix_key(first[i]);
+    std::less<U> comp;
+    sort_detail::introsort(keys, keys + n, comp);
+    for (size_t i = 0; i < n; i++) {
+      first[i] = sort_detail::radix_value<T>(keys[i]);
+    }
+    return;
+  }
+  constexpr size_t digits = sizeof(T);
+  size_t count[digits][256] = {};
+  for (T *p = first; p != last; ++p) {
+    U key = sort_detail::radix_key(*p);
+    for (size_t d = 0; d < digits; d++) count[d][key >> (8 * d) & 255]++;
+  }
+  std::unique_ptr<T[]> buffer(new T[n]);
+  T *src = first;
+  T *dst = buffer.get();
+  U head = sort_detail::radix_key(*first);
+  for (size_t d = 0; d < digits; d++) {
+    size_t *offset = count[d];
+    if (offset[head >> (8 * d) & 255] == n) continue;
+    size_t sum = 0;
+    for (size_t b = 0; b < 256; b++) {
+      size_t c = offset[b];
+      offset[b] = sum;
+      sum += c;
+    }
+    for (size_t i = 0; i < n; i++) {
+      U key = sort_detail::radix_key(src[i]);
+      dst[offset[key >> (8 * d) & 255]++] = src[i];
+    }
+    std::swap(src, dst);
+  }
+  if (src != first) std::memcpy(first, src, n * sizeof(T));
+}
+
+// Сортирует по возрастанию comp. Указатели на целые и числа с плавающей
+// точкой со сравнением по умолчанию сортируются поразрядно, остальное -
+// интроспективно. Сортировка неустойчива
+template <class It, class Compare = std::less<>>
+void sort(It first, It last, Compare comp = Compare()) {
+  using T = typename std::iterator_traits<It>::value_type;
+  if constexpr (std::is_pointer<It>::value && sort_detail::radix_sortable<T> &&
+                sort_detail::default_less<Compare, T>) {
+    radix_sort(first, last);
+  } else {
+    sort_detail::introsort(first, last, comp);
+  }
+}
+
+template <class T, class Growth, class Compare = std::less<>>
+void sort(vector<T, Growth> &v, Compare comp = Compare()) {
+  s21::sort(v.data(), v.data() + v.size(), std::move(comp));
+}
+
+// Вид сортируется на месте: span - как диапазон указателей, strided_span -
+// интроспективно через свой итератор
+template <class T, class Compare = std::less<>>
+void sort(span<T> s, Compare comp = Compare()) {
+  s21::sort(s.begin(), s.end(), std::move(comp));
+}
+
+template <class T, class Compare = std::less<>>
+void sort(strided_span<T> s, Compare comp = Compare()) {
+  s21::sort(s.begin(), s.end(), std::move(comp));
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_SORT_HPP_
@@ -0,0 +1,269 @@
+#ifndef SRC_S21_SPAN_HPP_
+#define SRC_S21_SPAN_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+template <class T>
+class strided_span;
+
+namespace span_detail {
+
+// Контейнер c подходит для span<T>, если c.data() лежит подряд и
+// приводится к T* без смены типа элемента (только добавлением const)
+template <class C, class T, class = void>
+struct contiguous_of : std::false_type {};
+template <class C, class T>
+struct contiguous_of<C, T,
+                     std::void_t<decltype(std::declval<C &>().data()),
+                                 decltype(std::declval<C &>().size())>>
+    : std::is_convertible<
+          std::remove_pointer_t<decltype(std::declval<C &>().data())> (*)[],
+          T (*)[]> {};
+
+}  // namespace span_detail
+
+// Невладеющий вид на непрерывный участок: указатель и длина. Берётся от
+// s21::vector, s21::array, s21::small_vector, сырого массива или пары
+// указателей и копируется за два слова вместо копии элементов. Подходит
+// алгоритмам s21::simd и s21::sort. operator[] не проверяет границы, at,
+// first, last и subspan бросают std::out_of_range
+template <class T>
+class span {
+ public:
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using reference = T &;
+  using const_reference = const T &;
+  using pointer = T *;
+  using iterator = T *;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+  constexpr span() = default;
+  constexpr span(T *data, size_type size) : data_(data), size_(size) {}
+  // Шаблон, чтобы span(p, 0) не был неоднозначным
+  template <class It,
+            std::enable_if_t<std::is_convertible<It, T *>::value, int> = 0>
+  constexpr span(It first, It last)
+      : data_(first), size_(static_cast<size_type>(last - first)) {}
+  template <size_t N>
+  constexpr span(T (&items)[N]) : data_(items), size_(N) {}
+  // Любой непрерывный контейнер с data() и size()
+  template <class C,
+            std::enable_if_t<!std::is_same<std::remove_cv_t<C>, span>::value &&
+                                 span_detail::contiguous_of<C, T>::value,
+                             int> = 0>
+  constexpr span(C &c) : data_(c.data()), size_(c.size()) {}
+  // span<U> в span<const U>
+  template <class U,
+            std::enable_if_t<!std::is_same<U, T>::value &&
+                                 std::is_convertible<U (*)[], T (*)[]>::value,
+                             int> = 0>
+  constexpr span(const span<U> &other)
+      : data_(other.data()), size_(other.size()) {}
+
+  constexpr T *data() const { return data_; }
+  constexpr size_type size() const { return size_; }
+  constexpr size_type size_bytes() const { return size_ * sizeof(T); }
+  constexpr bool empty() const { return size_ == 0; }
+
+  constexpr T *begin() const { return data_; }
+  constexpr T *end() const { return data_ + size_; }
+  reverse_iterator rbegin() const { return reverse_iterator(end()); }
+  reverse_iterator rend() const { return reverse_iterator(begin()); }
+
+  constexpr T &operator[](size_type pos) const { return data_[pos]; }
+  T &at(size_type pos) const {
+    if (pos >= size_) throw std::out_of_range("Index out of range");
+    return data_[pos];
+  }
+  constexpr T &front() const { return data_[0]; }
+  constexpr T &back() const { return data_[size_ - 1]; }
+
+  // Первые и последние count элементов
+  span first(size_type count) const { return subspan(0, count); }
+  span last(size_type count) const {
+    if (count > size_) throw std::out_of_range("Index out of range");
+    return {data_ + (size_ - count), count};
+  }
+  // count элементов с offset; npos - до конца
+  span subspan(size_type offset, size_type count = npos) const;
+  // Каждый step-й элемент, начиная с первого
+  strided_span<T> strided(size_type step) const;
+
+ private:
+  T *data_{nullptr};
+  size_type size_{0};
+};
+
+template <class T, size_t N>
+span(T (&)[N]) -> span<T>;
+template <class C>
+span(C &) -> span<std::remove_pointer_t<decltype(std::declval<C &>().data())>>;
+
+// Невладеющий вид на элементы с постоянным шагом (в элементах): столбец
+// матрицы, каждый k-й отсчёт, один канал перемежённого сигнала. Итератор
+// произвольного доступа хранит номер, а не указатель, поэтому end() не
+// выходит за границы буфера. Элементы не лежат подряд, так что ядрам
+// s21::simd вид отдаётся только через as_span() при шаге 1, а s21::sort
+// работает через итераторы
+template <class T>
+class strided_span {
+ public:
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using reference = T &;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+
+  class iterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = strided_span::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T *;
+    using reference = T &;
+
+    iterator() = default;
+    iterator(T *data, difference_type stride, difference_type pos)
+        : data_(data), stride_(stride), pos_(pos) {}
+
+    T &operator*() const { return data_[pos_ * stride_]; }
+    T *operator->() const { return data_ + pos_ * stride_; }
+    T &operator[](difference_type n) const {
+      return data_[(pos_ + n) * stride_];
+    }
+    iterator &operator++() {
+      ++pos_;
+      return *this;
+    }
+    iterator &operator--() {
+      --pos_;
+      return *this;
+    }
+    iterator operator++(int) { return {data_, stride_, pos_++}; }
+    iterator operator--(int) { return {data_, stride_, pos_--}; }
+    iterator &operator+=(difference_type n) {
+      pos_ += n;
+      return *this;
+    }
+    iterator &operator-=(difference_type n) {
+      pos_ -= n;
+      return *this;
+    }
+    iterator operator+(difference_type n) const {
+      return {data_, stride_, pos_ + n};
+    }
+    friend iterator operator+(difference_type n, const iterator &it) {
+      return it + n;
+    }
+    iterator operator-(difference_type n) const {
+      return {data_, stride_, pos_ - n};
+    }
+    difference_type operator-(const iterator &it) const {
+      return pos_ - it.pos_;
+    }
+    bool operator==(const iterator &it) const { return pos_ == it.pos_; }
+    bool operator!=(const iterator &it) const { return pos_ != it.pos_; }
+    bool operator<(const iterator &it) const { return pos_ < it.pos_; }
+    bool operator>(const iterator &it) const { return pos_ > it.pos_; }
+    bool operator<=(const iterator &it) const { return pos_ <= it.pos_; }
+    bool operator>=(const iterator &it) const { return pos_ >= it.pos_; }
+
+   private:
+    T *data_{nullptr};
+    difference_type stride_{1};
+    difference_type pos_{0};
+  };
+
+  strided_span() = default;
+  strided_span(T *data, size_type size, difference_type stride)
+      : data_(data), size_(size), stride_(stride) {}
+
+  T *data() const { return data_; }
+  size_type size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  // Расстояние между соседними элементами в элементах T
+  difference_type stride() const { return stride_; }
+  // Элементы лежат подряд и вид можно отдать ядрам s21::simd
+  bool contiguous() const { return stride_ == 1 || size_ <= 1; }
+  span<T> as_span() const;
+
+  iterator begin() const { return {data_, stride_, 0}; }
+  iterator end() const {
+    return {data_, stride_, static_cast<difference_type>(size_)};
+  }
+
+  T &operator[](size_type pos) const {
+    return data_[static_cast<difference_type>(pos) * stride_];
+  }
+  T &at(size_type pos) const {
+    if (pos >= size_) throw std::out_of_range("Index out of range");
+    return (*this)[pos];
+  }
+  T &front() const { return data_[0]; }
+  T &back() const { return (*this)[size_ - 1]; }
+
+  strided_span subspan(size_type offset,
+                       size_type count = span<T>::npos) const;
+  // Каждый step-й элемент этого вида
+  strided_span strided(size_type step) const;
+
+ private:
+  T *data_{nullptr};
+  size_type size_{0};
+  difference_type stride_{1};
+};
+
+template <class T>
+span<T> span<T>::subspan(size_type offset, size_type count) const {
+  if (offset > size_) throw std::out_of_range("Index out of range");
+  if (count == npos) count = size_ - offset;
+  if (count > size_ - offset) throw std::out_of_range("Index out of range");
+  return {data_ + offset, count};
+}
+
+template <class T>
+strided_span<T> span<T>::strided(size_type step) const {
+  if (step == 0) throw std::invalid_argument("Zero stride");
+  return {data_, (size_ + step - 1) / step,
+          static_cast<difference_type>(step)};
+}
+
+template <class T>
+span<T> strided_span<T>::as_span() const {
+  if (!contiguous()) throw std::logic_error("strided_span is not contiguous");
+  return {data_, size_};
+}
+
+template <class T>
+strided_span<T> strided_span<T>::subspan(size_type offset,
+                                         size_type count) const {
+  if (offset > size_) throw std::out_of_range("Index out of range");
+  if (count == span<T>::npos) count = size_ - offset;
+  if (count > size_ - offset) throw std::out_of_range("Index out of range");
+  // У пустого хвоста указатель не сдвигается за конец буфера
+  if (count == 0) return {data_, 0, stride_};
+  return {data_ + static_cast<difference_type>(offset) * stride_, count,
+          stride_};
+}
+
+template <class T>
+strided_span<T> strided_span<T>::strided(size_type step) const {
+  if (step == 0) throw std::invalid_argument("Zero stride");
+  return {data_, (size_ + step - 1) / step,
+          stride_ * static_cast<difference_type>(step)};
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_SPAN_HPP_
@@ -48,7 +48,7 @@ class stack {
 
   template <class... Args>
   void emplace_front(Args &&...args) {
-    list.emplace_front(args...);
+    list.insert_many_front(std::forward<Args>(args)...);
   }
 };
 }  // namespace s21
@@ -0,0 +1,238 @@
+#ifndef SRC_S21_THREAD_POOL_HPP_
+#define SRC_S21_THREAD_POOL_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace s21 {
+
+// Пул потоков с перехватом работы. parallel_for(count, f) вызывает f(i)
+// для всех i < count и возвращается, когда все вызовы завершены. Диапазон
+// кладётся одной задачей; исполнитель откусывает от неё половины и
+// складывает их в свою очередь, а простаивающие потоки крадут из чужих
+// очередей самые большие куски. Поэтому соседние индексы обычно
+// выполняются одним потоком, а ожидающий поток сам выполняет задачи, и
+// вложенные parallel_for не блокируют пул
+class thread_pool {
+ public:
+  // threads - число потоков вместе с вызывающим: фоновых создаётся
+  // threads - 1. pin привязывает фоновый поток i к процессору i + 1, чтобы
+  // память, которую поток заполнил первым, оставалась на его узле NUMA
+  explicit thread_pool(size_t threads = std::thread::hardware_concurrency(),
+                       bool pin = false);
+  thread_pool(const thread_pool &) = delete;
+  thread_pool &operator=(const thread_pool &) = delete;
+  ~thread_pool();
+
+  size_t size() const { return workers_.size() + 1; }
+
+  template <class F>
+  void parallel_for(size_t count, F &&f);
+
+ private:
+  struct job {
+    // Функция хранится как const void *, чтобы подходили и константные
+    // объекты; run снимает const только у неконстантных
+    void (*run)(const void *, size_t);
+    const void *fn;
+    std::atomic<size_t> remaining;
+    std::atomic<bool> failed{false};
+    std::exception_ptr error;
+    std::mutex error_mutex;
+  };
+  struct task {
+    job *owner;
+    size_t begin;
+    size_t end;
+  };
+  // Очередь одного потока: владелец берёт с конца, воры - с начала
+  struct alignas(64) task_queue {
+    std::mutex mutex_;
+    std::deque<task> tasks_;
+  };
+
+  std::vector<std::thread> workers_;
+  // Очереди фоновых потоков и последняя, общая, для внешних потоков
+  std::vector<task_queue> queues_;
+  std::atomic<size_t> queued_{0};
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+  bool stop_{false};
+
+  // Очередь текущего потока в этом пуле
+  size_t own_queue() const;
+  void push(size_t queue, const task &t);
+  bool pop(size_t queue, task &t);
+  bool steal(size_t thief, task &t);
+  // Выполняет одну задачу из своей или чужой очереди
+  bool run_one(size_t queue);
+  void execute(size_t queue, task t);
+  void worker_loop(size_t queue);
+  // Будит и присоединяет все фоновые потоки
+  void stop_workers();
+  static void pin_to_cpu(std::thread &thread, size_t cpu);
+
+  struct current {
+    const thread_pool *pool;
+    size_t queue;
+  };
+  static current &this_thread() {
+    static thread_local current cur{nullptr, 0};
+    return cur;
+  }
+};
+
+inline thread_pool::thread_pool(size_t threads, bool pin)
+    : queues_(threads ? threads : 1) {
+  size_t background = queues_.size() - 1;
+  workers_.reserve(background);
+  // Если поток не создался, уже запущенные останавливаются и
+  // присоединяются: иначе деструктор std::thread вызвал бы terminate
+  try {
+    for (size_t i = 0; i < background; i++) {
+      workers_.emplace_back([this, i] { worker_loop(i); });
+      if (pin) pin_to_cpu(workers_.back(), i + 1);
+    }
+  } catch (...) {
+    stop_workers();
+    throw;
+  }
+}
+
+inline thread_pool::~thread_pool() { stop_workers(); }
+
+inline void thread_pool::stop_workers() {
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    stop_ = true;
+  }
+  wake_.notify_all();
+  for (std::thread &worker : workers_) worker.join();
+}
+
+template <class F>
+void thread_pool::parallel_for(size_t count, F &&f) {
+  if (count == 0) return;
+  using Fn = std::remove_reference_t<F>;
+  job work;
+  work.run = [](const void *fn, size_t i) {
+    (*static_cast<Fn *>(const_cast<void *>(fn)))(i);
+  };
+  work.fn = &f;
+  work.remaining.store(count, std::memory_order_relaxed);
+  size_t queue = own_queue();
+  execute(queue, task{&work, 0, count});
+  while (work.remaining.load(std::memory_order_acquire) != 0) {
+    if (!run_one(queue)) std::this_thread::yield();
+  }
+  if (work.error) std::rethrow_exception(work.error);
+}
+
+inline size_t thread_pool::own_queue() const {
+  const current &cur = this_thread();
+  return cur.pool == this ? cur.queue : queues_.size() - 1;
+}
+
+inline void thread_pool::push(size_t queue, const task &t) {
+  {
+    std::lock_guard<std::mutex> lock(queues_[queue].mutex_);
+    queues_[queue].tasks_.push_back(t);
+  }
+  queued_.fetch_add(1, std::memory_order_release);
+  if (!workers_.empty()) {
+    { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+    wake_.notify_one();
+  }
+}
+
+inline bool thread_pool::pop(size_t queue, task &t) {
+  std::lock_guard<std::mutex> lock(queues_[queue].mutex_);
+  if (queues_[queue].tasks_.empty()) return false;
+  t = queues_[queue].tasks_.back();
+  queues_[queue].tasks_.pop_back();
+  queued_.fetch_sub(1, std::memory_order_relaxed);
+  return true;
+}
+
+// Обход начинается с соседней очереди, чтобы воры не толпились у одной
+inline bool thread_pool::steal(size_t thief, task &t) {
+  for (size_t k = 1; k < queues_.size(); k++) {
+    task_queue &victim = queues_[(thief + k) % queues_.size()];
+    std::lock_guard<std::mutex> lock(victim.mutex_);
+    if (victim.tasks_.empty()) continue;
+    t = victim.tasks_.front();
+    victim.tasks_.pop_front();
+    queued_.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+  }
+  return false;
+}
+
+inline bool thread_pool::run_one(size_t queue) {
+  task t;
+  if (!pop(queue, t) && !steal(queue, t)) return false;
+  execute(queue, t);
+  return true;
+}
+
+// Правая половина уходит в очередь, левая дробится дальше. После ошибки
+// оставшиеся индексы задания только отмечаются выполненными
+inline void thread_pool::execute(size_t queue, task t) {
+  while (t.end - t.begin > 1) {
+    size_t mid = t.begin + (t.end - t.begin) / 2;
+    push(queue, task{t.owner, mid, t.end});
+    t.end = mid;
+  }
+  job *owner = t.owner;
+  if (!owner->failed.load(std::memory_order_relaxed)) {
+    try {
+      owner->run(owner->fn, t.begin);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(owner->error_mutex);
+      if (!owner->error) owner->error = std::current_exception();
+      owner->failed.store(true, std::memory_order_relaxed);
+    }
+  }
+  owner->remaining.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+inline void thread_pool::worker_loop(size_t queue) {
+  this_thread() = current{this, queue};
+  for (;;) {
+    if (run_one(queue)) continue;
+    std::unique_lock<std::mutex> lock(sleep_mutex_);
+    wake_.wait(lock, [this] {
+      return stop_ || queued_.load(std::memory_order_acquire) != 0;
+    });
+    if (stop_) return;
+  }
+}
+
+inline void thread_pool::pin_to_cpu(std::thread &thread, size_t cpu) {
+#if defined(__linux__)
+  size_t cpus = std::thread::hardware_concurrency();
+  if (!cpus) return;
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu % cpus, &set);
+  pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set);
+#else
+  (void)thread;
+  (void)cpu;
+#endif
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_THREAD_POOL_HPP_
@@ -1,8 +1,44 @@
 #ifndef SRC_S21_VECTOR_HPP_
 #define SRC_S21_VECTOR_HPP_
 
+#include <algorithm>
+#include <cstring>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 namespace s21 {
-template <typename T>
+
+// Политики роста vector: next(capacity) даёт вместимость после очередного
+// роста, вектор берёт из неё и требуемого размера большее
+struct growth_double {
+  static size_t next(size_t capacity) { return capacity ? 2 * capacity : 1; }
+};
+
+// Рост в 1.5 раза: меньше запас памяти, зато больше переездов
+struct growth_one_and_half {
+  static size_t next(size_t capacity) { return capacity + capacity / 2 + 1; }
+};
+
+// Рост на Step элементов: запас не больше Step, но число переездов растёт
+// линейно; для больших массивов под mremap это дёшево
+template <size_t Step>
+struct growth_fixed {
+  static_assert(Step > 0, "growth step must be positive");
+  static size_t next(size_t capacity) { return capacity + Step; }
+};
+
+template <typename T, class Growth = growth_double>
 class vector {
  private:
   T* arr_;
@@ -17,43 +53,127 @@ class vector {
   using const_reference = const T&;
   using size_type = size_t;
 
+  using difference_type = std::ptrdiff_t;
+
+  // Итератор произвольного доступа поверх указателя на элемент
   class iterator {
    public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
     T* array_;
     iterator() : array_(nullptr) {}
-    explicit iterator(const vector<T>& one) { array_ = one.arr_; }
-    T& operator+(int n) { return *(array_ + n); }
-    T& operator-(int n) { return *(array_ - n); }
-    T& operator++(int) { return *array_++; }
-    T& operator--(int) { return *array_--; }
-    T& operator++() { return *++array_; }
-    T& operator--() { return *--array_; }
+    explicit iterator(T* one) : array_(one) {}
 
-    bool operator!=(const iterator& it) { return array_ != it.array_; }
-    bool operator==(const iterator& it) { return array_ == it.array_; }
+    iterator& operator++() {
+      ++array_;
+      return *this;
+    }
+    iterator& operator--() {
+      --array_;
+      return *this;
+    }
+    iterator operator++(int) { return iterator(array_++); }
+    iterator operator--(int) { return iterator(array_--); }
+    iterator& operator+=(difference_type n) {
+      array_ += n;
+      return *this;
+    }
+    iterator& operator-=(difference_type n) {
+      array_ -= n;
+      return *this;
+    }
+    iterator operator+(difference_type n) const { return iterator(array_ + n); }
+    iterator operator-(difference_type n) const { return iterator(array_ - n); }
+    friend iterator operator+(difference_type n, iterator it) { return it + n; }
+    difference_type operator-(const iterator& it) const {
+      return array_ - it.array_;
+    }
 
     T& operator*() const { return *array_; }
-
-    ~iterator() { array_ = nullptr; }
+    T* operator->() const { return array_; }
+    T& operator[](difference_type n) const { return array_[n]; }
+
+    bool operator==(const iterator& it) const { return array_ == it.array_; }
+    bool operator!=(const iterator& it) const { return array_ != it.array_; }
+    bool operator<(const iterator& it) const { return array_ < it.array_; }
+    bool operator>(const iterator& it) const { return array_ > it.array_; }
+    bool operator<=(const iterator& it) const { return array_ <= it.array_; }
+    bool operator>=(const iterator& it) const { return array_ >= it.array_; }
   };
 
+  // Константный итератор; неявно получается из iterator, поэтому смешанные
+  // сравнения и разности идут через его операторы
   class const_iterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
     const T* array_;
     const_iterator() : array_(nullptr) {}
-    explicit const_iterator(T* one) : array_(one) {}
-    T& operator+(int n) { return *(array_ + n); }
-    T& operator-(int n) { return *(array_ - n); }
-    T& operator=(const iterator& it) { return array_ = it; }
+    explicit const_iterator(const T* one) : array_(one) {}
+    const_iterator(const iterator& it) : array_(it.array_) {}
 
-    T& operator++(int) { return *array_++; }
-    T& operator--(int) { return *array_--; }
-    T& operator++() { return *++array_; }
-    T& operator--() { return *--array_; }
+    const_iterator& operator++() {
+      ++array_;
+      return *this;
+    }
+    const_iterator& operator--() {
+      --array_;
+      return *this;
+    }
+    const_iterator operator++(int) { return const_iterator(array_++); }
+    const_iterator operator--(int) { return const_iterator(array_--); }
+    const_iterator& operator+=(difference_type n) {
+      array_ += n;
+      return *this;
+    }
+    const_iterator& operator-=(difference_type n) {
+      array_ -= n;
+      return *this;
+    }
+    const_iterator operator+(difference_type n) const {
+      return const_iterator(array_ + n);
+    }
+    const_iterator operator-(difference_type n) const {
+      return const_iterator(array_ - n);
+    }
+    friend const_iterator operator+(difference_type n, const_iterator it) {
+      return it + n;
+    }
+    friend difference_type operator-(const const_iterator& a,
+                                     const const_iterator& b) {
+      return a.array_ - b.array_;
+    }
 
-    bool operator!=(const iterator& it) { return array_ != it.array; }
-    bool operator==(const iterator& it) { return array_ == it.array; }
+    const T& operator*() const { return *array_; }
+    const T* operator->() const { return array_; }
+    const T& operator[](difference_type n) const { return array_[n]; }
 
-    ~const_iterator() { delete[] array_; }
+    friend bool operator==(const const_iterator& a, const const_iterator& b) {
+      return a.array_ == b.array_;
+    }
+    friend bool operator!=(const const_iterator& a, const const_iterator& b) {
+      return a.array_ != b.array_;
+    }
+    friend bool operator<(const const_iterator& a, const const_iterator& b) {
+      return a.array_ < b.array_;
+    }
+    friend bool operator>(const const_iterator& a, const const_iterator& b) {
+      return a.array_ > b.array_;
+    }
+    friend bool operator<=(const const_iterator& a, const const_iterator& b) {
+      return a.array_ <= b.array_;
+    }
+    friend bool operator>=(const const_iterator& a, const const_iterator& b) {
+      return a.array_ >= b.array_;
+    }
   };
 
   vector();
@@ -62,278 +182,689 @@ class vector {
   vector(const vector& v);
   vector(vector&& v);
   ~vector();
-  vector operator=(vector&& v);
+  vector& operator=(const vector& v);
+  vector& operator=(vector&& v);
   reference at(size_type pos);
+  const_reference at(size_type pos) const;
   T& operator[](size_type pos);
-  const_reference front();
-  const_reference back();
-  iterator data();
+  const T& operator[](size_type pos) const;
+  const_reference front() const;
+  const_reference back() const;
+  T* data();
+  const T* data() const;
   iterator begin();
   iterator end();
-  bool empty();
-  size_type size();
-  size_type max_size();
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
   void reserve(size_type size);
-  size_type capacity();
+  size_type capacity() const;
   void shrink_to_fit();
   void clear();
-  iterator insert(iterator pos, const_reference value);
-  void erase(iterator pos);
+  iterator insert(const_iterator pos, const_reference value);
+  iterator insert(const_iterator pos, T&& value);
+  iterator insert(const_iterator pos, size_type count, const_reference value);
+  template <class InputIt,
+            std::enable_if_t<!std::is_integral<InputIt>::value, int> = 0>
+  iterator insert(const_iterator pos, InputIt first, InputIt last);
+  iterator insert(const_iterator pos, std::initializer_list<value_type> items);
+  iterator erase(const_iterator pos);
+  iterator erase(const_iterator first, const_iterator last);
+  void assign(size_type count, const_reference value);
+  template <class InputIt,
+            std::enable_if_t<!std::is_integral<InputIt>::value, int> = 0>
+  void assign(InputIt first, InputIt last);
+  void assign(std::initializer_list<value_type> items);
+  void resize(size_type count);
+  void resize(size_type count, const_reference value);
   void push_back(const_reference value);
+  void push_back(T&& value);
   void pop_back();
   void swap(vector& other);
   template <typename... Args>
   iterator emplace(const_iterator pos, Args&&... args);
   template <typename... Args>
-  void emplace_back(Args&&... args);
+  reference emplace_back(Args&&... args);
+
+ private:
+  // Массивы тривиально копируемых типов от kMapThreshold байт лежат в
+  // анонимном отображении: рост идёт через mremap без копирования, а
+  // память помечается для прозрачных huge pages
+  static constexpr size_type kMapThreshold = size_type(1) << 20;
+  static constexpr size_type kHugePage = size_type(2) << 20;
+
+  // Память под n элементов без их конструирования
+  static T* allocate(size_type n);
+  // Освобождает память, выделенную allocate(n)
+  static void deallocate(T* p, size_type n);
+  // Лежит ли массив вместимостью n в отображении
+  static bool mapped(size_type n);
+  static size_type map_length(size_type n);
+  static void advise_huge(void* p, size_type length);
+  // Разрушает элементы [first, last)
+  static void destroy(T* first, T* last);
+  // Переносит n элементов из src в неинициализированную dst; исходные
+  // разрушает вызывающий. Тривиально копируемые типы переносятся memcpy
+  static void relocate(T* src, size_type n, T* dst);
+  // Вместимость при росте до need элементов
+  size_type grow_capacity(size_type need) const;
+  // Переезжает в новую память вместимостью n
+  void reallocate(size_type n);
+  // Вставка n элементов в позицию idx с переездом: construct(p) строит их
+  // в новой памяти до переноса старых, поэтому аргументы могут ссылаться
+  // на элементы этого вектора
+  template <class F>
+  void reallocate_insert(size_type idx, size_type n, F&& construct);
+  // Добавляет [first, last) в конец и поворотом ставит их на место idx
+  template <class InputIt>
+  iterator append_rotate(size_type idx, InputIt first, InputIt last);
 };
 
-template <typename T>
-template <typename... Args>
-void vector<T>::emplace_back(Args&&... args) {
-  for (auto& elem : {args...}) {
-    push_back(elem);
+// Итератор хотя бы однонаправленный: длину диапазона можно узнать заранее
+template <class It, class = void>
+struct is_forward_iterator : std::false_type {};
+
+template <class It>
+struct is_forward_iterator<
+    It, std::void_t<typename std::iterator_traits<It>::iterator_category>>
+    : std::is_base_of<std::forward_iterator_tag,
+                      typename std::iterator_traits<It>::iterator_category> {
+};
+
+template <typename T, class Growth>
+bool vector<T, Growth>::mapped(size_type n) {
+#if defined(__linux__)
+  if constexpr (std::is_trivially_copyable_v<T> && alignof(T) <= 4096) {
+    return n && n >= (kMapThreshold + sizeof(T) - 1) / sizeof(T);
   }
+#endif
+  (void)n;
+  return false;
 }
 
-// Вставляет элементы в конкретную позицию и возвращает итератор, указывающий
-// на новый элемент +
-template <typename T>
-typename vector<T>::iterator vector<T>::insert(vector<T>::iterator pos,
-                                               const T& value) {
-  T* newarr = new T[size_ + 1];
-  size_t count = 0;
-  for (; pos != begin(); count++, --pos) {
+// Длина отображения, округлённая до страницы
+template <typename T, class Growth>
+typename vector<T, Growth>::size_type vector<T, Growth>::map_length(
+    size_type n) {
+#if defined(__linux__)
+  static const size_type page = sysconf(_SC_PAGESIZE);
+#else
+  const size_type page = 4096;
+#endif
+  return (n * sizeof(T) + page - 1) / page * page;
+}
+
+template <typename T, class Growth>
+void vector<T, Growth>::advise_huge(void* p, size_type length) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  if (length >= kHugePage) madvise(p, length, MADV_HUGEPAGE);
+#endif
+  (void)p;
+  (void)length;
+}
+
+template <typename T, class Growth>
+T* vector<T, Growth>::allocate(size_type n) {
+  if (!n) return nullptr;
+#if defined(__linux__)
+  if (mapped(n)) {
+    void* p = mmap(nullptr, map_length(n), PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) throw std::bad_alloc();
+    advise_huge(p, map_length(n));
+    return static_cast<T*>(p);
+  }
+#endif
+  if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+    return static_cast<T*>(
+        ::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+  } else {
+    return static_cast<T*>(::operator new(n * sizeof(T)));
+  }
+}
+
+template <typename T, class Growth>
+void vector<T, Growth>::deallocate(T* p, size_type n) {
+  if (!p) return;
+#if defined(__linux__)
+  if (mapped(n)) {
+    munmap(p, map_length(n));
+    return;
+  }
+#endif
+  if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+    ::operator delete(p, std::align_val_t(alignof(T)));
+  } else {
+    ::operator delete(p);
+  }
+}
+
+template <typename T, class Growth>
+void vector<T, Growth>::destroy(T* first, T* last) {
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    for (; first != last; ++first) first->~T();
   }
-  newarr[count] = value;
-  for (size_t i = 0; i < size_; i++) {
-    if (i < count) {
-      newarr[i] = arr_[i];
-    } else {
-      newarr[i + 1] = arr_[i];
+}
+
+// Если перемещение может бросить, элементы копируются: при исключении
+// исходный массив остаётся целым
+template <typename T, class Growth>
+void vector<T, Growth>::relocate(T* src, size_type n, T* dst) {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    if (n) std::memcpy(static_cast<void*>(dst), src, n * sizeof(T));
+  } else {
+    size_type i = 0;
+    try {
+      for (; i < n; i++) new (dst + i) T(std::move_if_noexcept(src[i]));
+    } catch (...) {
+      destroy(dst, dst + i);
+      throw;
     }
   }
-  delete[] arr_;
+}
+
+template <typename T, class Growth>
+typename vector<T, Growth>::size_type
+vector<T, Growth>::grow_capacity(size_type need) const {
+  if (need > max_size()) throw std::length_error("vector");
+  size_type grown = Growth::next(capacity_);
+  if (grown < capacity_ || grown > max_size()) grown = max_size();
+  return grown < need ? need : grown;
+}
+
+template <typename T, class Growth>
+void vector<T, Growth>::reallocate(size_type n) {
+#if defined(__linux__)
+  if (mapped(capacity_) && mapped(n)) {
+    void* p =
+        mremap(arr_, map_length(capacity_), map_length(n), MREMAP_MAYMOVE);
+    if (p == MAP_FAILED) throw std::bad_alloc();
+    advise_huge(p, map_length(n));
+    arr_ = static_cast<T*>(p);
+    capacity_ = n;
+    return;
+  }
+#endif
+  T* newarr = allocate(n);
+  try {
+    relocate(arr_, size_, newarr);
+  } catch (...) {
+    deallocate(newarr, n);
+    throw;
+  }
+  destroy(arr_, arr_ + size_);
+  deallocate(arr_, capacity_);
   arr_ = newarr;
-  size_++;
-  capacity_ = size_;
-  pos = begin();
-  while (count) {
-    count--;
-    ++pos;
+  capacity_ = n;
+}
+
+template <typename T, class Growth>
+template <class F>
+void vector<T, Growth>::reallocate_insert(size_type idx, size_type n,
+                                          F&& construct) {
+  size_type cap = grow_capacity(size_ + n);
+  T* newarr = allocate(cap);
+  try {
+    construct(newarr + idx);
+  } catch (...) {
+    deallocate(newarr, cap);
+    throw;
+  }
+  try {
+    relocate(arr_, idx, newarr);
+    try {
+      relocate(arr_ + idx, size_ - idx, newarr + idx + n);
+    } catch (...) {
+      destroy(newarr, newarr + idx);
+      throw;
+    }
+  } catch (...) {
+    destroy(newarr + idx, newarr + idx + n);
+    deallocate(newarr, cap);
+    throw;
   }
-  return pos;
+  destroy(arr_, arr_ + size_);
+  deallocate(arr_, capacity_);
+  arr_ = newarr;
+  size_ += n;
+  capacity_ = cap;
 }
 
-// Уменьшает использование памяти, освобождая неиспользуемую память +
-template <typename T>
-void vector<T>::shrink_to_fit() {
+// Хвост сдвигается поворотом, то есть перемещениями; для тривиальных типов
+// std::rotate сводится к memmove
+template <typename T, class Growth>
+template <class InputIt>
+typename vector<T, Growth>::iterator
+vector<T, Growth>::append_rotate(size_type idx, InputIt first, InputIt last) {
+  size_type old_size = size_;
+  try {
+    for (; first != last; ++first) emplace_back(*first);
+  } catch (...) {
+    while (size_ > old_size) pop_back();
+    throw;
+  }
+  std::rotate(arr_ + idx, arr_ + old_size, arr_ + size_);
+  return iterator(arr_ + idx);
+}
+
+// Конструирует элемент в конце из переданных аргументов. При росте новый
+// элемент строится до переноса старых: аргумент может ссылаться на элемент
+// этого же вектора. Тривиально копируемый элемент строится во временной
+// копии, чтобы рост мог пойти через reallocate и mremap
+template <typename T, class Growth>
+template <typename... Args>
+typename vector<T, Growth>::reference
+vector<T, Growth>::emplace_back(Args&&... args) {
   if (size_ < capacity_) {
-    T* newarr = new T[size_];
-    for (size_t i = 0; i < size_; i++) {
-      newarr[i] = arr_[i];
+    new (arr_ + size_) T(std::forward<Args>(args)...);
+  } else if constexpr (std::is_trivially_copyable_v<T>) {
+    T tmp(std::forward<Args>(args)...);
+    reallocate(grow_capacity(size_ + 1));
+    new (arr_ + size_) T(std::move(tmp));
+  } else {
+    reallocate_insert(size_, 1, [&](T* p) {
+      new (p) T(std::forward<Args>(args)...);
+    });
+    return arr_[size_ - 1];
+  }
+  return arr_[size_++];
+}
+
+// Вставляет элемент перед pos. Без переезда хвост сдвигается на одну
+// позицию перемещениями (memmove для тривиальных типов), а новый элемент
+// строится заранее: аргументы могут ссылаться на сдвигаемые элементы
+template <typename T, class Growth>
+template <typename... Args>
+typename vector<T, Growth>::iterator
+vector<T, Growth>::emplace(const_iterator pos, Args&&... args) {
+  size_type idx = pos.array_ - arr_;
+  if (size_ == capacity_) {
+    reallocate_insert(idx, 1, [&](T* p) {
+      new (p) T(std::forward<Args>(args)...);
+    });
+  } else if (idx == size_) {
+    new (arr_ + size_) T(std::forward<Args>(args)...);
+    size_++;
+  } else {
+    T tmp(std::forward<Args>(args)...);
+    new (arr_ + size_) T(std::move(arr_[size_ - 1]));
+    size_++;
+    std::move_backward(arr_ + idx, arr_ + size_ - 2, arr_ + size_ - 1);
+    arr_[idx] = std::move(tmp);
+  }
+  return iterator(arr_ + idx);
+}
+
+// Вставляет элементы в конкретную позицию и возвращает итератор, указывающий
+// на новый элемент +
+template <typename T, class Growth>
+typename vector<T, Growth>::iterator
+vector<T, Growth>::insert(const_iterator pos, const T& value) {
+  return emplace(pos, value);
+}
+
+template <typename T, class Growth>
+typename vector<T, Growth>::iterator
+vector<T, Growth>::insert(const_iterator pos, T&& value) {
+  return emplace(pos, std::move(value));
+}
+
+template <typename T, class Growth>
+typename vector<T, Growth>::iterator
+vector<T, Growth>::insert(const_iterator pos, size_type count, const T& value) {
+  size_type idx = pos.array_ - arr_;
+  if (!count) return iterator(arr_ + idx);
+  if (size_ + count > capacity_) {
+    reallocate_insert(idx, count, [&](T* p) {
+      size_type i = 0;
+      try {
+        for (; i < count; i++) new (p + i) T(value);
+      } catch (...) {
+        destroy(p, p + i);
+        throw;
+      }
+    });
+    return iterator(arr_ + idx);
+  }
+  T tmp(value);
+  size_type old_size = size_;
+  try {
+    while (size_ < old_size + count) emplace_back(tmp);
+  } catch (...) {
+    while (size_ > old_size) pop_back();
+    throw;
+  }
+  std::rotate(arr_ + idx, arr_ + old_size, arr_ + size_);
+  return iterator(arr_ + idx);
+}
+
+// Диапазон не должен указывать в этот вектор. Для однонаправленных
+// итераторов память выделяется не более одного раза
+template <typename T, class Growth>
+template <class InputIt,
+          std::enable_if_t<!std::is_integral<InputIt>::value, int>>
+typename vector<T, Growth>::iterator
+vector<T, Growth>::insert(const_iterator pos, InputIt first, InputIt last) {
+  size_type idx = pos.array_ - arr_;
+  if constexpr (is_forward_iterator<InputIt>::value) {
+    size_type count = std::distance(first, last);
+    if (size_ + count > capacity_) {
+      reallocate_insert(idx, count, [&](T* p) {
+        size_type i = 0;
+        try {
+          for (InputIt it = first; it != last; ++it, ++i) new (p + i) T(*it);
+        } catch (...) {
+          destroy(p, p + i);
+          throw;
+        }
+      });
+      return iterator(arr_ + idx);
     }
-    delete[] arr_;
-    arr_ = newarr;
-    capacity_ = size_;
   }
+  return append_rotate(idx, first, last);
+}
+
+template <typename T, class Growth>
+typename vector<T, Growth>::iterator vector<T, Growth>::insert(
+    const_iterator pos, std::initializer_list<value_type> items) {
+  return insert(pos, items.begin(), items.end());
+}
+
+// Уменьшает использование памяти, освобождая неиспользуемую память +
+template <typename T, class Growth>
+void vector<T, Growth>::shrink_to_fit() {
+  if (size_ < capacity_) reallocate(size_);
+}
+
+// Стирает элемент на позиции, возвращает итератор на следующий
+template <typename T, class Growth>
+typename vector<T, Growth>::iterator
+vector<T, Growth>::erase(const_iterator pos) {
+  return erase(pos, pos + 1);
+}
+
+// Хвост сдвигается к first одним проходом перемещений, освободившиеся
+// элементы в конце разрушаются
+template <typename T, class Growth>
+typename vector<T, Growth>::iterator
+vector<T, Growth>::erase(const_iterator first, const_iterator last) {
+  T* from = arr_ + (first.array_ - arr_);
+  T* to = arr_ + (last.array_ - arr_);
+  if (from != to) {
+    T* new_end = std::move(to, arr_ + size_, from);
+    destroy(new_end, arr_ + size_);
+    size_ = new_end - arr_;
+  }
+  return iterator(from);
+}
+
+// Заменяет содержимое; память сохраняется, если её хватает
+template <typename T, class Growth>
+void vector<T, Growth>::assign(size_type count, const_reference value) {
+  T tmp(value);
+  destroy(arr_, arr_ + size_);
+  size_ = 0;
+  if (count > capacity_) reallocate(count);
+  while (size_ < count) emplace_back(tmp);
+}
+
+template <typename T, class Growth>
+template <class InputIt,
+          std::enable_if_t<!std::is_integral<InputIt>::value, int>>
+void vector<T, Growth>::assign(InputIt first, InputIt last) {
+  destroy(arr_, arr_ + size_);
+  size_ = 0;
+  if constexpr (is_forward_iterator<InputIt>::value) {
+    size_type count = std::distance(first, last);
+    if (count > capacity_) reallocate(count);
+  }
+  for (; first != last; ++first) emplace_back(*first);
 }
 
-// Стирает элемент на позиции
-template <typename T>
-void vector<T>::erase(vector<T>::iterator pos) {
-  size_t count;
-  for (count = 0; pos != begin(); count++, --pos) {
+template <typename T, class Growth>
+void vector<T, Growth>::assign(std::initializer_list<value_type> items) {
+  assign(items.begin(), items.end());
+}
+
+// Меняет размер: лишние элементы разрушаются, новые строятся как T() +
+template <typename T, class Growth>
+void vector<T, Growth>::resize(size_type count) {
+  if (count < size_) {
+    destroy(arr_ + count, arr_ + size_);
+    size_ = count;
+    return;
   }
-  for (size_t i = count; i < size_; ++i) {
-    arr_[i] = arr_[i + 1];
+  if (count > capacity_) reallocate(grow_capacity(count));
+  while (size_ < count) emplace_back();
+}
+
+template <typename T, class Growth>
+void vector<T, Growth>::resize(size_type count, const_reference value) {
+  if (count < size_) {
+    destroy(arr_ + count, arr_ + size_);
+    size_ = count;
+    return;
   }
-  --size_;
+  if (count > size_) insert(end(), count - size_, value);
+}
+
+// Оператор присваивания копированием
+template <typename T, class Growth>
+vector<T, Growth>& vector<T, Growth>::operator=(const vector<T, Growth>& a) {
+  if (this != &a) {
+    vector<T, Growth> tmp(a);
+    swap(tmp);
+  }
+  return *this;
 }
 
 // Перегрузка оператора присваивания для движущегося объекта +
-template <typename T>
-vector<T> vector<T>::operator=(vector<T>&& a) {
-  delete[] arr_;
-  size_ = a.size_;
-  capacity_ = a.capacity_;
-  arr_ = a.arr_;
-  a.size_ = 0;
-  a.capacity_ = 0;
-  a.arr_ = nullptr;
+template <typename T, class Growth>
+vector<T, Growth>& vector<T, Growth>::operator=(vector<T, Growth>&& a) {
+  if (this != &a) {
+    clear();
+    swap(a);
+  }
   return *this;
 }
 
 // Возвращает итератор в начало +
-template <typename T>
-typename vector<T>::iterator vector<T>::begin() {
-  return iterator(*this);
+template <typename T, class Growth>
+typename vector<T, Growth>::iterator vector<T, Growth>::begin() {
+  return iterator(arr_);
 }
 
-// Возвращает итератор в конец +
-template <typename T>
-typename vector<T>::iterator vector<T>::end() {
-  iterator vec_iterator = begin();
-  for (size_t i = 0; i != size_; i++) {
-    ++vec_iterator;
-  }
-  ++vec_iterator;
-  return vec_iterator;
+template <typename T, class Growth>
+typename vector<T, Growth>::const_iterator vector<T, Growth>::begin() const {
+  return const_iterator(arr_);
+}
+
+// Возвращает итератор на позицию за последним элементом +
+template <typename T, class Growth>
+typename vector<T, Growth>::iterator vector<T, Growth>::end() {
+  return iterator(arr_ + size_);
+}
+
+template <typename T, class Growth>
+typename vector<T, Growth>::const_iterator vector<T, Growth>::end() const {
+  return const_iterator(arr_ + size_);
 }
 
 // Проверяет, пуст ли контейнер +
-template <typename T>
-bool vector<T>::empty() {
+template <typename T, class Growth>
+bool vector<T, Growth>::empty() const {
   return size_ == 0;
 }
 
 // Деструктор +
-template <typename T>
-vector<T>::~vector() {
+template <typename T, class Growth>
+vector<T, Growth>::~vector() {
   clear();
 }
 
 // Очищаем содержимое +
-template <typename T>
-void vector<T>::clear() {
-  if (arr_) {
-    size_ = 0;
-    capacity_ = 0;
-    delete[] arr_;
-    arr_ = nullptr;
-  }
+template <typename T, class Growth>
+void vector<T, Growth>::clear() {
+  destroy(arr_, arr_ + size_);
+  deallocate(arr_, capacity_);
+  arr_ = nullptr;
+  size_ = 0;
+  capacity_ = 0;
 }
 
 // Конструктор по умолчанию, создает пустой вектор +
-template <typename T>
-vector<T>::vector() : arr_(nullptr), size_(0), capacity_(0) {}
-
-// Параметризованный конструктор, создает вектор размера n +
-template <typename T>
-vector<T>::vector(size_type n) : size_(n), capacity_(n) {
-  arr_ = new T[n];
+template <typename T, class Growth>
+vector<T, Growth>::vector() : arr_(nullptr), size_(0), capacity_(0) {}
+
+// Параметризованный конструктор, создает вектор из n элементов T() +
+template <typename T, class Growth>
+vector<T, Growth>::vector(size_type n)
+    : arr_(allocate(n)), size_(0), capacity_(n) {
+  try {
+    for (; size_ < n; size_++) new (arr_ + size_) T();
+  } catch (...) {
+    clear();
+    throw;
+  }
 }
 
-// Конструктор копирования +
-template <typename T>
-vector<T>::vector(const vector& v) : size_(v.size_), capacity_(v.capacity_) {
-  arr_ = new T[v.size_];
-  for (size_t i = 0; i < size_; i++) {
-    arr_[i] = v.arr_[i];
+// Конструктор копирования, вместимость равна размеру +
+template <typename T, class Growth>
+vector<T, Growth>::vector(const vector& v)
+    : arr_(allocate(v.size_)), size_(0), capacity_(v.size_) {
+  try {
+    for (; size_ < v.size_; size_++) new (arr_ + size_) T(v.arr_[size_]);
+  } catch (...) {
+    clear();
+    throw;
   }
 }
 
 // Конструктор списка инициализаторов,
 // создает вектор, инициализированный с помощью std::initializer_list +
-template <typename T>
-vector<T>::vector(std::initializer_list<value_type> const& items)
+template <typename T, class Growth>
+vector<T, Growth>::vector(std::initializer_list<value_type> const& items)
     : arr_(nullptr), size_(0), capacity_(0) {
+  if (items.size()) reserve(items.size());
   for (auto& elem : items) {
     push_back(elem);
   }
-  shrink_to_fit();
 }
 
 // Конструктор перемещения +
-template <typename T>
-vector<T>::vector(vector&& v)
+template <typename T, class Growth>
+vector<T, Growth>::vector(vector&& v)
     : arr_(v.arr_), size_(v.size_), capacity_(v.capacity_) {
-  for (size_t i = 0; i < size_; i++) {
-    arr_[i] = v.arr_[i];
-  }
   v.size_ = 0;
   v.capacity_ = 0;
   v.arr_ = nullptr;
 }
 
 // Доступ к указанному элементу +
-template <typename T>
-T& vector<T>::operator[](size_t pos) {
+template <typename T, class Growth>
+T& vector<T, Growth>::operator[](size_t pos) {
+  return arr_[pos];
+}
+
+template <typename T, class Growth>
+const T& vector<T, Growth>::operator[](size_t pos) const {
   return arr_[pos];
 }
 
 // Доступ к указанному элементу с проверкой границ +
-template <typename T>
-typename vector<T>::reference vector<T>::at(typename vector<T>::size_type pos) {
-  if (pos > size_) {
+template <typename T, class Growth>
+typename vector<T, Growth>::reference
+vector<T, Growth>::at(typename vector<T, Growth>::size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("terminate called after throwing an instance of ");
+  }
+  return arr_[pos];
+}
+
+template <typename T, class Growth>
+typename vector<T, Growth>::const_reference
+vector<T, Growth>::at(size_type pos) const {
+  if (pos >= size_) {
     throw std::out_of_range("terminate called after throwing an instance of ");
   }
   return arr_[pos];
 }
 
 // Прямой доступ к базовому массиву +
-template <typename T>
-typename vector<T>::iterator vector<T>::data() {
-  return begin();
+template <typename T, class Growth>
+T* vector<T, Growth>::data() {
+  return arr_;
+}
+
+template <typename T, class Growth>
+const T* vector<T, Growth>::data() const {
+  return arr_;
 }
 
 // Получить доступ к первому элементу +
-template <typename T>
-typename vector<T>::const_reference vector<T>::front() {
+template <typename T, class Growth>
+typename vector<T, Growth>::const_reference vector<T, Growth>::front() const {
   return arr_[0];
 }
 
 // Получить доступ к последнему элементу +
-template <typename T>
-typename vector<T>::const_reference vector<T>::back() {
+template <typename T, class Growth>
+typename vector<T, Growth>::const_reference vector<T, Growth>::back() const {
   return arr_[size_ - 1];
 }
 
 // Возвращает количество элементов +
-template <typename T>
-typename vector<T>::size_type vector<T>::size() {
+template <typename T, class Growth>
+typename vector<T, Growth>::size_type vector<T, Growth>::size() const {
   return size_;
 }
 
 // Возвращает максимально возможное количество элементов +
-template <typename T>
-typename vector<T>::size_type vector<T>::max_size() {
+template <typename T, class Growth>
+typename vector<T, Growth>::size_type vector<T, Growth>::max_size() const {
   return (std::numeric_limits<size_type>::max() / sizeof(T*));
 }
 
 // Возвращает количество элементов, которые могут храниться в выделенной на
 // данный момент памяти +
-template <typename T>
-typename vector<T>::size_type vector<T>::capacity() {
+template <typename T, class Growth>
+typename vector<T, Growth>::size_type vector<T, Growth>::capacity() const {
   return capacity_;
 }
 
-// выделяет хранилище элементов размера и копирует текущие элементы массива
-// в новый выделенный массив +
-template <typename T>
-void vector<T>::reserve(size_type size) {
+// выделяет хранилище элементов размера и переносит в него текущие
+// элементы +
+template <typename T, class Growth>
+void vector<T, Growth>::reserve(size_type size) {
   if (!size) size = 1;
-  if (size <= capacity_) {
-  } else {
-    T* newarr = new T[size];
-    for (size_t i = 0; i < size_; i++) {
-      newarr[i] = arr_[i];
-    }
-    delete[] arr_;
-    arr_ = newarr;
-    capacity_ = size;
-  }
+  if (size > max_size()) throw std::length_error("vector::reserve");
+  if (size > capacity_) reallocate(size);
 }
 
 // Добавляем элемент в конец +
-template <typename T>
-void vector<T>::push_back(const_reference value) {
-  if (capacity_ == size_) {
-    reserve(2 * size_);
-  }
-  arr_[size_] = value;
-  ++size_;
+template <typename T, class Growth>
+void vector<T, Growth>::push_back(const_reference value) {
+  emplace_back(value);
 }
 
-// Удаляет последний элемент +
-template <typename T>
-void vector<T>::pop_back() {
-  --size_;
+template <typename T, class Growth>
+void vector<T, Growth>::push_back(T&& value) {
+  emplace_back(std::move(value));
+}
+
+// Удаляет и разрушает последний элемент +
+template <typename T, class Growth>
+void vector<T, Growth>::pop_back() {
+  if (size_) arr_[--size_].~T();
 }
 
 // Меняет содержимое местами +
-template <typename T>
-void vector<T>::swap(vector& other) {
+template <typename T, class Growth>
+void vector<T, Growth>::swap(vector& other) {
   auto size = size_;
   auto capacity = capacity_;
   auto arr = arr_;
@@ -345,6 +876,17 @@ void vector<T>::swap(vector& other) {
   other.arr_ = arr;
 }
 
+// Удаляет элементы, для которых pred истинен, одним проходом уплотнения.
+// Возвращает число удалённых
+template <typename T, class Growth, class Pred>
+typename vector<T, Growth>::size_type erase_if(vector<T, Growth>& vec,
+                                               Pred pred) {
+  auto new_end = std::remove_if(vec.begin(), vec.end(), pred);
+  typename vector<T, Growth>::size_type removed = vec.end() - new_end;
+  vec.erase(new_end, vec.end());
+  return removed;
+}
+
 }  // namespace s21
 
 #endif  // SRC_S21_VECTOR_HPP_
@@ -1,19 +1,47 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <bitset>
+#include <cstdio>
+#include <cstring>
+#include <limits>
 #include <list>
+#include <memory>
+#include <numeric>
 #include <queue>
+#include <random>
+#include <set>
 #include <stack>
+#include <string>
+#include <thread>
+#include <tuple>
 
 #include "s21_containers.h"
 #include "s21_containersplus.h"
 #include "test_array.inc"
+#include "test_bitset.inc"
 #include "test_btree.inc"
+#include "test_chunked_list.inc"
+#include "test_concurrent_map.inc"
+#include "test_intrusive_btree.inc"
+#include "test_intrusive_list.inc"
 #include "test_list.inc"
+#include "test_lru_cache.inc"
 #include "test_map.inc"
+#include "test_mmap_vector.inc"
 #include "test_multiset.inc"
+#include "test_parallel.inc"
 #include "test_queue.inc"
+#include "test_radix_map.inc"
 #include "test_set.inc"
+#include "test_simd.inc"
+#include "test_slot_map.inc"
+#include "test_small_vector.inc"
+#include "test_soa_vector.inc"
+#include "test_sort.inc"
+#include "test_span.inc"
 #include "test_stack.inc"
 #include "test_vector.inc"
 